@@ -10,16 +10,90 @@
 
 #include "SX1276.h"
 
+// Count the SPI accesses of the enclosing function as operation op
+#ifdef SX1276_STATS
+#define SX1276_STATS_SCOPE(op) StatsScope statsScope(this, op)
+#else
+#define SX1276_STATS_SCOPE(op)
+#endif
+
+// Payload length of an FSK/OOK packet before its length byte has been read
+#define SX1276_LENGTH_UNKNOWN   0xFFFF
+
+#ifdef LORA_ENABLED
+// LoRa bandwidths in Hz, indexed by the MODEM_CONFIG_1 bandwidth field (SX1276_BW_* >> 4)
+static const uint32_t loraBandwidthHz[] SX1276_PROGMEM = {
+    7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000, 500000
+};
+#endif
+
+#ifdef FSK_OOK_ENABLED
+// FSK/OOK RX bandwidths supported by beginFSKHz() (upper limit in Hz, RX_BW value)
+struct RxBandwidth {
+    uint32_t maxHz;
+    uint8_t reg;
+};
+
+static const RxBandwidth fskRxBandwidth[] SX1276_PROGMEM = {
+    { 2600, SX1276_RX_BW_2_6_KHZ },
+    { 3900, SX1276_RX_BW_3_9_KHZ },
+    { 5200, SX1276_RX_BW_5_2_KHZ },
+    { 7800, SX1276_RX_BW_7_8_KHZ_FSK },
+    { 10400, SX1276_RX_BW_10_4_KHZ_FSK },
+    { 15600, SX1276_RX_BW_15_6_KHZ_FSK },
+    { 20800, SX1276_RX_BW_20_8_KHZ_FSK },
+    { 31300, SX1276_RX_BW_31_3_KHZ },
+    { 41700, SX1276_RX_BW_41_7_KHZ_FSK },
+    { 62500, SX1276_RX_BW_62_5_KHZ_FSK },
+    { 125000, SX1276_RX_BW_125_0_KHZ_FSK }
+};
+#endif
+
+#if SX1276_MAX_INSTANCES < 1 || SX1276_MAX_INSTANCES > 4
+#error "SX1276_MAX_INSTANCES must be 1-4"
+#endif
+
+#define SX1276_NO_ISR_SLOT 0xFF
+
+// Radios with an attached DIO0 interrupt and their handlers
+SX1276* volatile SX1276::_isrInstances[SX1276_MAX_INSTANCES];
+
+void (* const SX1276::_dio0Isrs[SX1276_MAX_INSTANCES])() = {
+    dio0Isr0,
+#if SX1276_MAX_INSTANCES > 1
+    dio0Isr1,
+#endif
+#if SX1276_MAX_INSTANCES > 2
+    dio0Isr2,
+#endif
+#if SX1276_MAX_INSTANCES > 3
+    dio0Isr3,
+#endif
+};
+
 /**
  * Constructor
  */
-SX1276::SX1276() {
+SX1276::SX1276()
+    : _spiSettings(SX1276_SPI_FREQUENCY, MSBFIRST, SPI_MODE0) {
     _csPin = -1;
     _rstPin = -1;
     _dio0Pin = -1;
+    _dio1Pin = -1;
     _freq = 0;
+    _startupTime = 0;
+    _calTime = 0;
+    _calTemp = 0;
+    _calBand = 0;
+    _calThreshold = SX1276_CAL_TEMP_THRESHOLD;
+    _mode = SX1276_MODE_UNKNOWN;
     _power = 17;
     _useBoost = true;
+    _channelPlan = nullptr;
+    _channelCount = 0;
+    _channelPlanP = false;
+    _dio0Flag = false;
+    _isrSlot = SX1276_NO_ISR_SLOT;
     
     // Set default modulation based on what's compiled in
 #if defined(LORA_ENABLED)
@@ -37,6 +111,7 @@ SX1276::SX1276() {
     _preambleLength = 8;
     _syncWord = 0x12;  // Private network
     _crcEnabled = true;
+    _hopPeriod = 0;
 #endif
 
 #ifdef FSK_OOK_ENABLED
@@ -49,21 +124,64 @@ SX1276::SX1276() {
     _preambleLengthFSK = 5;  // 5 bytes (40 bits) - typical for FSK
     _fixedLength = false;  // Variable length
     _crcOnFSK = true;
+    _payloadLengthFSK = SX1276_MAX_PACKET_LENGTH;
     _lastRSSI = 0;
+    _txData = nullptr;
+    _txRemaining = 0;
+    _rxData = nullptr;
+    _rxMaxLen = 0;
+    _rxLen = 0;
+    _rxRead = 0;
+    _rxStreaming = false;
+    _fifoPollUs = 0;
+    _fifoPollTime = 0;
+#endif
+
+    resetShadow();
+
+#ifdef SX1276_ASYNC_FIFO
+    _fifoBusy = false;
+    _txPending = false;
+    _txError = SX1276_ERR_NONE;
+    _rxTruncated = false;
+#endif
+
+#ifdef SX1276_RX_QUEUE
+    _rxHead = 0;
+    _rxCount = 0;
+    _rxOverflows = 0;
+#endif
+
+#ifdef SX1276_STATS
+    _statsActive = 1 << SX1276_STATS_TOTAL;
+    _statsBusStart = 0;
+    resetStats();
 #endif
 }
 
 /**
  * Constructor with pin configuration (RadioLib-compatible)
  */
-SX1276::SX1276(int cs, int irq, int rst, int gpio) {
-    (void)gpio;  // Unused parameter - reserved for future use
+SX1276::SX1276(int cs, int irq, int rst, int gpio)
+    : _spiSettings(SX1276_SPI_FREQUENCY, MSBFIRST, SPI_MODE0) {
     _csPin = cs;
     _rstPin = rst;
     _dio0Pin = irq;  // DIO0 is the primary interrupt pin
+    _dio1Pin = gpio;
     _freq = 0;
+    _startupTime = 0;
+    _calTime = 0;
+    _calTemp = 0;
+    _calBand = 0;
+    _calThreshold = SX1276_CAL_TEMP_THRESHOLD;
+    _mode = SX1276_MODE_UNKNOWN;
     _power = 17;
     _useBoost = true;
+    _channelPlan = nullptr;
+    _channelCount = 0;
+    _channelPlanP = false;
+    _dio0Flag = false;
+    _isrSlot = SX1276_NO_ISR_SLOT;
     
     // Set default modulation based on what's compiled in
 #if defined(LORA_ENABLED)
@@ -81,6 +199,7 @@ SX1276::SX1276(int cs, int irq, int rst, int gpio) {
     _preambleLength = 8;
     _syncWord = 0x12;  // Private network
     _crcEnabled = true;
+    _hopPeriod = 0;
 #endif
 
 #ifdef FSK_OOK_ENABLED
@@ -93,7 +212,38 @@ SX1276::SX1276(int cs, int irq, int rst, int gpio) {
     _preambleLengthFSK = 5;  // 5 bytes (40 bits) - typical for FSK
     _fixedLength = false;  // Variable length
     _crcOnFSK = true;
+    _payloadLengthFSK = SX1276_MAX_PACKET_LENGTH;
     _lastRSSI = 0;
+    _txData = nullptr;
+    _txRemaining = 0;
+    _rxData = nullptr;
+    _rxMaxLen = 0;
+    _rxLen = 0;
+    _rxRead = 0;
+    _rxStreaming = false;
+    _fifoPollUs = 0;
+    _fifoPollTime = 0;
+#endif
+
+    resetShadow();
+
+#ifdef SX1276_ASYNC_FIFO
+    _fifoBusy = false;
+    _txPending = false;
+    _txError = SX1276_ERR_NONE;
+    _rxTruncated = false;
+#endif
+
+#ifdef SX1276_RX_QUEUE
+    _rxHead = 0;
+    _rxCount = 0;
+    _rxOverflows = 0;
+#endif
+
+#ifdef SX1276_STATS
+    _statsActive = 1 << SX1276_STATS_TOTAL;
+    _statsBusStart = 0;
+    resetStats();
 #endif
 }
 
@@ -101,47 +251,186 @@ SX1276::SX1276(int cs, int irq, int rst, int gpio) {
  * Initialize the SX1276 module
  */
 int16_t SX1276::begin(long freq, int cs, int rst, int dio0) {
+    uint32_t start = SX1276Hal::micros();
+
     // Store pin assignments
     _csPin = cs;
     _rstPin = rst;
+    if (dio0 != _dio0Pin) {
+        // The interrupt is still attached to the previous pin
+        releaseInterrupt();
+    }
     _dio0Pin = dio0;
     _freq = freq;
     
-    // Initialize pins
-    pinMode(_csPin, OUTPUT);
-    digitalWrite(_csPin, HIGH);
-    
-    pinMode(_rstPin, OUTPUT);
-    pinMode(_dio0Pin, INPUT);
-    
-    // Initialize SPI
-    SPI.begin();
-    
-    // Reset the module
-    int16_t state = reset();
+    // Reset and detect the module
+    int16_t state = startup();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Check version register
-    uint8_t version = readRegister(SX1276_REG_VERSION);
-    if (version != 0x12) {
-        SX1276_DEBUG_PRINT(F("SX1276: Chip version mismatch, expected 0x12, got 0x"));
-        SX1276_DEBUG_PRINTLN(version, HEX);
-        return SX1276_ERR_CHIP_NOT_FOUND;
-    }
-    
-    SX1276_DEBUG_PRINTLN(F("SX1276: Chip found"));
-    
     // Configure the module
     state = config();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
+    _startupTime = SX1276Hal::micros() - start;
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Get the duration of the last successful begin()
+ */
+uint32_t SX1276::getStartupTime() const {
+    return _startupTime;
+}
+
+/**
+ * Warm start with the simplified API's pin and frequency arguments
+ */
+int16_t SX1276::resume(long freq, int cs, int rst, int dio0) {
+    _csPin = cs;
+    _rstPin = rst;
+    if (dio0 != _dio0Pin) {
+        // The interrupt is still attached to the previous pin
+        releaseInterrupt();
+    }
+    _dio0Pin = dio0;
+    _freq = freq;
+    
+    return resume();
+}
+
+/**
+ * Warm start: skip reset and configuration if the chip still holds the configuration
+ */
+int16_t SX1276::resume() {
+    uint32_t start = SX1276Hal::micros();
+    
+    initHardware();
+    
+    if (readRegister(SX1276_REG_VERSION) == 0x12 && verifyConfig()) {
+        SX1276_DEBUG_PRINTLN(F("SX1276: Warm start"));
+        
+        // The driver object may be new - take the shadow cache and mode from the chip
+        resyncShadow();
+        _mode = SX1276_MODE_UNKNOWN;
+        
+#ifdef FSK_OOK_ENABLED
+        // Payload length is not part of the compared settings - keep the chip's
+        if (_modulation != SX1276_MODULATION_LORA) {
+            uint8_t length[2];
+            readRegisterBurst(SX1276_REG_PACKET_CONFIG_2, length, sizeof(length));
+            _payloadLengthFSK = ((uint16_t)(length[0] & 0x07) << 8) | length[1];
+        }
+#endif
+        
+        int16_t state = standby();
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+    } else {
+        SX1276_DEBUG_PRINTLN(F("SX1276: Configuration lost, cold start"));
+        
+        int16_t state = reset();
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+        
+        state = config();
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+    }
+    
+    _startupTime = SX1276Hal::micros() - start;
     return SX1276_ERR_NONE;
 }
 
+/**
+ * Compare key registers with the values the current configuration would write
+ * (modulation, frequency, output power and the main modem parameters)
+ */
+bool SX1276::verifyConfig() {
+    // OP_MODE .. PA_CONFIG (0x01-0x09)
+    uint8_t regs[9];
+    readRegisterBurst(SX1276_REG_OP_MODE, regs, sizeof(regs));
+    
+    // Configuration is only retained in sleep and standby
+    uint8_t opMode = regs[0];
+    if ((opMode & 0x07) > SX1276_MODE_STDBY) {
+        return false;
+    }
+    
+    uint32_t frf = frequencyToFrf(_freq);
+    if (regs[5] != ((frf >> 16) & 0xFF) || regs[6] != ((frf >> 8) & 0xFF) || regs[7] != (frf & 0xFF)) {
+        return false;
+    }
+    
+    uint8_t paConfig;
+    uint8_t paDac;
+    powerToPaConfig(_power, _useBoost, paConfig, paDac);
+    if (regs[8] != paConfig || readRegister(SX1276_REG_PA_DAC) != paDac) {
+        return false;
+    }
+    
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA) {
+        if (!(opMode & SX1276_LORA_MODE)) {
+            return false;
+        }
+        
+        // MODEM_CONFIG_1/2, SYMB_TIMEOUT_LSB, PREAMBLE_MSB/LSB (0x1D-0x21)
+        uint8_t modem[5];
+        readRegisterBurst(SX1276_REG_MODEM_CONFIG_1, modem, sizeof(modem));
+        return modem[0] == (_bw | _cr) &&
+               modem[1] == ((_sf << 4) | (_crcEnabled ? 0x04 : 0x00)) &&
+               modem[3] == ((_preambleLength >> 8) & 0xFF) &&
+               modem[4] == (_preambleLength & 0xFF) &&
+               readRegister(SX1276_REG_SYNC_WORD) == _syncWord;
+    }
+#endif
+    
+#ifdef FSK_OOK_ENABLED
+    if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
+        uint8_t modulationType = (_modulation == SX1276_MODULATION_OOK) ? 0x20 : 0x00;
+        if ((opMode & (SX1276_LORA_MODE | 0x60)) != modulationType) {
+            return false;
+        }
+        
+        // Bitrate and frequency deviation (0x02-0x05)
+        uint32_t bitrateReg = SX1276Reg::bitrate(_bitrate);
+        uint32_t fdevReg = SX1276Reg::fdev(_freqDev);
+        if (regs[1] != ((bitrateReg >> 8) & 0xFF) || regs[2] != (bitrateReg & 0xFF) ||
+            regs[3] != ((fdevReg >> 8) & 0x3F) || regs[4] != (fdevReg & 0xFF)) {
+            return false;
+        }
+        
+        if (readRegister(SX1276_REG_RX_BW) != _rxBw) {
+            return false;
+        }
+        
+        // Preamble, sync word configuration, sync word and PACKET_CONFIG_1 (0x25-0x30)
+        uint8_t packet[12];
+        readRegisterBurst(SX1276_REG_PREAMBLE_MSB_FSK, packet, sizeof(packet));
+        if (packet[0] != ((_preambleLengthFSK >> 8) & 0xFF) || packet[1] != (_preambleLengthFSK & 0xFF) ||
+            packet[2] != (0x90 | ((_syncWordLen - 1) & 0x07)) ||
+            packet[11] != ((_fixedLength ? 0x80 : 0x00) | (_crcOnFSK ? 0x10 : 0x00))) {
+            return false;
+        }
+        for (uint8_t i = 0; i < _syncWordLen && i < 8; i++) {
+            if (packet[3 + i] != _syncWordFSK[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+#endif
+    
+    return false;
+}
+
 /**
  * Set modulation type
  */
@@ -165,10 +454,10 @@ int16_t SX1276::setModem(uint8_t modem) {
 
 #ifdef LORA_ENABLED
 /**
- * Initialize in LoRa mode (RadioLib-compatible)
+ * Initialize in LoRa mode (integer units)
  */
-int16_t SX1276::begin(float freq, float bw, uint8_t sf, uint8_t cr, 
-                      uint8_t syncWord, int8_t power, uint16_t preambleLength, uint8_t gain) {
+int16_t SX1276::beginLoRaHz(uint32_t freq, uint32_t bw, uint8_t sf, uint8_t cr, 
+                            uint8_t syncWord, int8_t power, uint16_t preambleLength, uint8_t gain) {
     (void)gain;  // Gain setting not yet implemented
     
     // Check if pins were configured via constructor
@@ -176,50 +465,33 @@ int16_t SX1276::begin(float freq, float bw, uint8_t sf, uint8_t cr,
         return SX1276_ERR_CHIP_NOT_FOUND;  // Pins not configured
     }
     
-    // Convert frequency from MHz to Hz
-    long freqHz = (long)(freq * 1000000.0);
-    
-    // Initialize hardware
-    pinMode(_csPin, OUTPUT);
-    digitalWrite(_csPin, HIGH);
-    pinMode(_rstPin, OUTPUT);
-    pinMode(_dio0Pin, INPUT);
-    
-    SPI.begin();
-    
-    // Reset the module
-    int16_t state = reset();
+    uint32_t start = SX1276Hal::micros();
+
+    // Reset and detect the module
+    int16_t state = startup();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Check version register
-    uint8_t version = readRegister(SX1276_REG_VERSION);
-    if (version != 0x12) {
-        return SX1276_ERR_CHIP_NOT_FOUND;
-    }
-    
     // Set LoRa mode
     _modulation = SX1276_MODULATION_LORA;
-    _freq = freqHz;
+    _freq = freq;
     _power = power;
     
     // Configure LoRa parameters from arguments
-    // Convert bandwidth from kHz to register value
-    if (bw == 7.8) _bw = SX1276_BW_7_8_KHZ;
-    else if (bw == 10.4) _bw = SX1276_BW_10_4_KHZ;
-    else if (bw == 15.6) _bw = SX1276_BW_15_6_KHZ;
-    else if (bw == 20.8) _bw = SX1276_BW_20_8_KHZ;
-    else if (bw == 31.25) _bw = SX1276_BW_31_25_KHZ;
-    else if (bw == 41.7) _bw = SX1276_BW_41_7_KHZ;
-    else if (bw == 62.5) _bw = SX1276_BW_62_5_KHZ;
-    else if (bw == 125.0) _bw = SX1276_BW_125_KHZ;
-    else if (bw == 250.0) _bw = SX1276_BW_250_KHZ;
-    else if (bw == 500.0) _bw = SX1276_BW_500_KHZ;
-    else _bw = SX1276_BW_125_KHZ;  // Default
+    // Convert bandwidth from Hz to register value (table index = bits 7-4)
+    _bw = SX1276_BW_125_KHZ;  // Default
+    for (uint8_t i = 0; i < sizeof(loraBandwidthHz) / sizeof(loraBandwidthHz[0]); i++) {
+        uint32_t bwHz;
+        SX1276Hal::readProgmem(&bwHz, &loraBandwidthHz[i], sizeof(bwHz));
+        if (bw == bwHz) {
+            _bw = i << 4;
+            break;
+        }
+    }
     
     _sf = sf;
-    _cr = ((cr - 5) << 1);  // Convert denominator (5-8) to register value (0x02-0x08)
+    _cr = ((cr - 4) << 1);  // Convert denominator (5-8) to register value (0x02-0x08)
     _preambleLength = preambleLength;
     _syncWord = syncWord;
     _crcEnabled = true;
@@ -230,68 +502,51 @@ int16_t SX1276::begin(float freq, float bw, uint8_t sf, uint8_t cr,
         return state;
     }
     
+    _startupTime = SX1276Hal::micros() - start;
     return SX1276_ERR_NONE;
 }
 #endif
 
 #ifdef FSK_OOK_ENABLED
 /**
- * Initialize in FSK/OOK mode (RadioLib-compatible)
+ * Initialize in FSK/OOK mode (integer units)
  */
-int16_t SX1276::beginFSK(float freq, float br, float freqDev, float rxBw, 
-                         int8_t power, uint16_t preambleLength, bool enableOOK) {
+int16_t SX1276::beginFSKHz(uint32_t freq, uint32_t br, uint32_t freqDev, uint32_t rxBw, 
+                           int8_t power, uint16_t preambleLength, bool enableOOK) {
     // Check if pins were configured via constructor
     if (_csPin < 0 || _rstPin < 0 || _dio0Pin < 0) {
         return SX1276_ERR_CHIP_NOT_FOUND;  // Pins not configured
     }
     
-    // Convert frequency from MHz to Hz
-    long freqHz = (long)(freq * 1000000.0);
-    
-    // Initialize hardware
-    pinMode(_csPin, OUTPUT);
-    digitalWrite(_csPin, HIGH);
-    pinMode(_rstPin, OUTPUT);
-    pinMode(_dio0Pin, INPUT);
-    
-    SPI.begin();
-    
-    // Reset the module
-    int16_t state = reset();
+    uint32_t start = SX1276Hal::micros();
+
+    // Reset and detect the module
+    int16_t state = startup();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Check version register
-    uint8_t version = readRegister(SX1276_REG_VERSION);
-    if (version != 0x12) {
-        return SX1276_ERR_CHIP_NOT_FOUND;
-    }
-    
     // Set FSK or OOK mode
     _modulation = enableOOK ? SX1276_MODULATION_OOK : SX1276_MODULATION_FSK;
-    _freq = freqHz;
+    _freq = freq;
     _power = power;
     
     // Configure FSK/OOK parameters from arguments
-    _bitrate = (uint32_t)(br * 1000.0);  // Convert kbps to bps
-    _freqDev = (uint32_t)(freqDev * 1000.0);  // Convert kHz to Hz
+    _bitrate = br;
+    _freqDev = freqDev;
     _preambleLengthFSK = preambleLength;
     
-    // Convert RX bandwidth from kHz to register value
-    // Simplified mapping - use closest value
-    if (rxBw <= 2.6) _rxBw = SX1276_RX_BW_2_6_KHZ;
-    else if (rxBw <= 3.9) _rxBw = SX1276_RX_BW_3_9_KHZ;
-    else if (rxBw <= 5.2) _rxBw = SX1276_RX_BW_5_2_KHZ;
-    else if (rxBw <= 7.8) _rxBw = SX1276_RX_BW_7_8_KHZ_FSK;
-    else if (rxBw <= 10.4) _rxBw = SX1276_RX_BW_10_4_KHZ_FSK;
-    else if (rxBw <= 15.6) _rxBw = SX1276_RX_BW_15_6_KHZ_FSK;
-    else if (rxBw <= 20.8) _rxBw = SX1276_RX_BW_20_8_KHZ_FSK;
-    else if (rxBw <= 31.3) _rxBw = SX1276_RX_BW_31_3_KHZ;
-    else if (rxBw <= 41.7) _rxBw = SX1276_RX_BW_41_7_KHZ_FSK;
-    else if (rxBw <= 62.5) _rxBw = SX1276_RX_BW_62_5_KHZ_FSK;
-    else if (rxBw <= 125.0) _rxBw = SX1276_RX_BW_125_0_KHZ_FSK;
-    else _rxBw = SX1276_RX_BW_250_0_KHZ_FSK;
+    // Convert RX bandwidth from Hz to register value
+    // Simplified mapping - use the next wider bandwidth
+    _rxBw = SX1276_RX_BW_250_0_KHZ_FSK;
+    for (uint8_t i = 0; i < sizeof(fskRxBandwidth) / sizeof(fskRxBandwidth[0]); i++) {
+        RxBandwidth entry;
+        SX1276Hal::readProgmem(&entry, &fskRxBandwidth[i], sizeof(entry));
+        if (rxBw <= entry.maxHz) {
+            _rxBw = entry.reg;
+            break;
+        }
+    }
     
     // Configure the module
     state = config();
@@ -299,6 +554,7 @@ int16_t SX1276::beginFSK(float freq, float br, float freqDev, float rxBw,
         return state;
     }
     
+    _startupTime = SX1276Hal::micros() - start;
     return SX1276_ERR_NONE;
 }
 #endif
@@ -308,19 +564,109 @@ int16_t SX1276::beginFSK(float freq, float br, float freqDev, float rxBw,
  */
 void SX1276::end() {
     sleep();
-    SPI.end();
+    releaseInterrupt();
+    SX1276Hal::spiDeinit();
+}
+
+/**
+ * Destructor
+ */
+SX1276::~SX1276() {
+    releaseInterrupt();
+}
+
+/**
+ * Initialize pins and SPI
+ */
+void SX1276::initHardware() {
+    // Initialize pins
+    SX1276Hal::pinMode(_csPin, OUTPUT);
+    SX1276Hal::digitalWrite(_csPin, HIGH);
+    _csFast = SX1276Hal::fastPin(_csPin);
+    
+    SX1276Hal::pinMode(_rstPin, OUTPUT);
+    SX1276Hal::pinMode(_dio0Pin, INPUT);
+    
+    // Claim a DIO0 interrupt slot (kept on repeated begin()); without one,
+    // completion is detected from the DIO0 pin level only
+    if (_isrSlot == SX1276_NO_ISR_SLOT) {
+        for (uint8_t i = 0; i < SX1276_MAX_INSTANCES; i++) {
+            if (_isrInstances[i] == nullptr) {
+                _isrSlot = i;
+                _isrInstances[i] = this;
+                break;
+            }
+        }
+    }
+    if (_isrSlot != SX1276_NO_ISR_SLOT) {
+        SX1276Hal::attachInterrupt(_dio0Pin, _dio0Isrs[_isrSlot]);
+    }
+    
+    if (_dio1Pin >= 0) {
+        SX1276Hal::pinMode(_dio1Pin, INPUT);
+    }
+    
+    // Initialize SPI
+    SX1276Hal::spiInit();
+}
+
+/**
+ * Detach the DIO0 interrupt and free its slot
+ */
+void SX1276::releaseInterrupt() {
+    if (_isrSlot == SX1276_NO_ISR_SLOT) {
+        return;
+    }
+    SX1276Hal::detachInterrupt(_dio0Pin);
+    _isrInstances[_isrSlot] = nullptr;
+    _isrSlot = SX1276_NO_ISR_SLOT;
+}
+
+/**
+ * Initialize pins and SPI, reset the module and check that it responds
+ */
+int16_t SX1276::startup() {
+    initHardware();
+    
+    // Reset the module (includes the version check)
+    int16_t state = reset();
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+    
+    SX1276_DEBUG_PRINTLN(F("SX1276: Chip found"));
+    return SX1276_ERR_NONE;
 }
 
 /**
  * Reset the module
+ * Datasheet minimums: > 100 us reset pulse, then the chip is ready within 5 ms -
+ * poll the version register instead of waiting for the worst case
  */
 int16_t SX1276::reset() {
     // Perform reset sequence
-    digitalWrite(_rstPin, LOW);
-    delay(10);
-    digitalWrite(_rstPin, HIGH);
-    delay(10);
-    
+    SX1276Hal::digitalWrite(_rstPin, LOW);
+    SX1276Hal::delayMicroseconds(SX1276_RESET_PULSE_US);
+    SX1276Hal::digitalWrite(_rstPin, HIGH);
+
+    // All registers are back at their reset values, the power-on
+    // calibration was done at the default frequency
+    resetShadow();
+    _calBand = 0;
+    _mode = 0x09;  // FSK/OOK, LowFrequencyModeOn, standby
+
+    // Wait until the chip responds
+    uint32_t start = SX1276Hal::micros();
+    uint8_t version;
+    while ((version = readRegister(SX1276_REG_VERSION)) != 0x12) {
+        if (SX1276Hal::micros() - start > SX1276_RESET_TIMEOUT_US) {
+            SX1276_DEBUG_PRINT(F("SX1276: Chip version mismatch, expected 0x12, got 0x"));
+            SX1276_DEBUG_PRINTLN(version, HEX);
+            return SX1276_ERR_CHIP_NOT_FOUND;
+        }
+        SX1276Hal::delayMicroseconds(SX1276_RESET_POLL_US);
+    }
+
     return SX1276_ERR_NONE;
 }
 
@@ -328,174 +674,376 @@ int16_t SX1276::reset() {
  * Configure the module
  */
 int16_t SX1276::config() {
-    int16_t state = SX1276_ERR_NONE;
-    
+    SX1276_STATS_SCOPE(SX1276_STATS_CONFIG);
+
     SX1276_DEBUG_PRINT(F("config() called, _modulation="));
     SX1276_DEBUG_PRINTLN(_modulation);
     
 #if defined(LORA_ENABLED) && defined(FSK_OOK_ENABLED)
     // Both modes available - check which one is selected
-    if (_modulation == SX1276_MODULATION_LORA) {
-        SX1276_DEBUG_PRINTLN(F("Configuring LoRa mode"));
+    if (_modulation != SX1276_MODULATION_LORA) {
+        SX1276_DEBUG_PRINTLN(F("Calling configFSK()"));
+        return configFSK();
+    }
 #endif
 
 #ifdef LORA_ENABLED
-        // Set to sleep mode for configuration (LoRa mode)
-        state = sleep();
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        // Set LoRa mode
-        writeRegister(SX1276_REG_OP_MODE, SX1276_MODE_SLEEP | SX1276_LORA_MODE);
-        delay(10);
-        
-        // Set to standby mode
-        state = standby();
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        // Set frequency (cast to long to avoid ambiguity with float overload)
-        state = setFrequency((long)_freq);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        // Set FIFO base addresses
-        writeRegister(SX1276_REG_FIFO_TX_BASE_ADDR, 0x00);
-        writeRegister(SX1276_REG_FIFO_RX_BASE_ADDR, 0x00);
-        
-        // Set LNA boost
-        writeRegister(SX1276_REG_LNA, readRegister(SX1276_REG_LNA) | 0x03);
-        
-        // Set auto AGC
-        writeRegister(SX1276_REG_MODEM_CONFIG_3, 0x04);
-        
-        // Set output power
-        state = setPower(_power, _useBoost);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        // Set OCP to 240mA
-        writeRegister(SX1276_REG_OCP, 0x20 | 0x1B);
-        
-        // Set LoRa parameters
-        state = setBandwidth(_bw);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        state = setSpreadingFactor(_sf);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        state = setCodingRate(_cr);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        state = setPreambleLength(_preambleLength);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        state = setSyncWord(_syncWord);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        state = setCRC(_crcEnabled);
-        if (state != SX1276_ERR_NONE) {
-            return state;
+    // Register image from the current settings (validated by applyProfile())
+    SX1276LoRaProfile profile(_freq, _bw, _sf, _cr, _syncWord, _power, _preambleLength, _crcEnabled, _useBoost);
+    int16_t state = applyProfile(profile);
+    if (state == SX1276_ERR_NONE && _hopPeriod != 0) {
+        // Not part of the profile; the channel plan may have been cleared
+        // while in FSK/OOK mode (stopHopping())
+        if (_channelCount == 0) {
+            _hopPeriod = 0;
         }
-        
-        // Set DIO0 to TxDone/RxDone
-        writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
-#endif
-
-#if defined(LORA_ENABLED) && defined(FSK_OOK_ENABLED)
-    } else {
-        // FSK/OOK mode
-        SX1276_DEBUG_PRINTLN(F("Calling configFSK()"));
-        return configFSK();
+        writeRegister(SX1276_REG_HOP_PERIOD, _hopPeriod);
     }
-#elif defined(FSK_OOK_ENABLED)
+    return state;
+#else
     // Only FSK/OOK mode available
     SX1276_DEBUG_PRINTLN(F("FSK only mode, calling configFSK()"));
     return configFSK();
 #endif
-    
-    SX1276_DEBUG_PRINTLN(F("config() returning"));
-    return state;
 }
 
+#ifdef LORA_ENABLED
 /**
- * Set carrier frequency
+ * Initialize in LoRa mode from a configuration profile
  */
-int16_t SX1276::setFrequency(long freq) {
-    // Check frequency range (137-1020 MHz)
-    if (freq < 137000000L || freq > 1020000000L) {
-        return SX1276_ERR_INVALID_FREQUENCY;
+int16_t SX1276::begin(const SX1276LoRaProfile& profile) {
+    // Check if pins were configured via constructor
+    if (_csPin < 0 || _rstPin < 0 || _dio0Pin < 0) {
+        return SX1276_ERR_CHIP_NOT_FOUND;  // Pins not configured
     }
     
-    _freq = freq;
+    uint32_t start = SX1276Hal::micros();
     
-    // Calculate frequency register value
-    // FRF = (Freq × 2^19) / FXOSC
-    uint32_t frf = ((uint64_t)freq << 19) / SX1276_FXOSC;
+    // Reset and detect the module
+    int16_t state = startup();
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
     
-    // Write frequency registers
-    writeRegister(SX1276_REG_FRF_MSB, (frf >> 16) & 0xFF);
-    writeRegister(SX1276_REG_FRF_MID, (frf >> 8) & 0xFF);
-    writeRegister(SX1276_REG_FRF_LSB, frf & 0xFF);
+    state = applyProfile(profile);
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
     
+    _startupTime = SX1276Hal::micros() - start;
     return SX1276_ERR_NONE;
 }
 
 /**
- * Set carrier frequency (RadioLib-compatible with MHz)
+ * Initialize in LoRa mode from a configuration profile in program memory
  */
-int16_t SX1276::setFrequency(float freq) {
-    // Convert MHz to Hz and call the Hz version
-    long freqHz = (long)(freq * 1000000.0);
-    return setFrequency(freqHz);
+int16_t SX1276::begin_P(const SX1276LoRaProfile* profile) {
+    SX1276LoRaProfile copy;
+    SX1276Hal::readProgmem(&copy, profile, sizeof(copy));
+    return begin(copy);
 }
 
 /**
- * Set output power
+ * Apply a LoRa configuration profile
  */
-int16_t SX1276::setPower(int8_t power, bool useBoost) {
-    _power = power;
-    _useBoost = useBoost;
+int16_t SX1276::applyProfile(const SX1276LoRaProfile& profile) {
+    SX1276_STATS_SCOPE(SX1276_STATS_CONFIG);
+
+    // Same limits as the setters
+    uint8_t bw = profile.modem[0] & 0xF0;
+    uint8_t cr = profile.modem[0] & 0x0E;
+    uint8_t sf = profile.modem[1] >> 4;
+    if (profile.freq < 137000000UL || profile.freq > 1020000000UL) {
+        return SX1276_ERR_INVALID_FREQUENCY;
+    }
+    if (bw > SX1276_BW_500_KHZ) {
+        return SX1276_ERR_INVALID_BANDWIDTH;
+    }
+    if (sf < SX1276_SF_6 || sf > SX1276_SF_12) {
+        return SX1276_ERR_INVALID_SPREADING_FACTOR;
+    }
+    if (cr < SX1276_CR_4_5 || cr > SX1276_CR_4_8) {
+        return SX1276_ERR_INVALID_CODING_RATE;
+    }
+
+    // Set to sleep mode for configuration
+    int16_t state = sleep();
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+    
+    // Set LoRa mode (takes effect immediately in sleep mode)
+    writeRegister(SX1276_REG_OP_MODE, SX1276_MODE_SLEEP | SX1276_LORA_MODE);
     
-    uint8_t paConfig = 0;
-    uint8_t paDac = 0x84;  // Default +17dBm
+    // Set to standby mode
+    state = standby();
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
     
-    if (useBoost) {
-        // PA_BOOST pin
-        if (power > 17) {
-            // Enable high power mode (+20dBm)
-            if (power > 20) {
-                power = 20;
+    // Frequency, PA_CONFIG, PA_RAMP, OCP and LNA (0x06-0x0C)
+    writeRegisterBurst(SX1276_REG_FRF_MSB, profile.rf, sizeof(profile.rf));
+    writeRegister(SX1276_REG_PA_DAC, profile.paDac);
+
+    // Set FIFO base addresses (TX and RX base are consecutive registers)
+    const uint8_t fifoBase[2] = { 0x00, 0x00 };
+    writeRegisterBurst(SX1276_REG_FIFO_TX_BASE_ADDR, fifoBase, sizeof(fifoBase));
+
+    // MODEM_CONFIG_1: BW | CR | explicit header
+    // MODEM_CONFIG_2: SF | normal TX mode | CRC | SymbTimeout MSB = 0
+    // followed by SYMB_TIMEOUT_LSB and the preamble length
+    writeRegisterBurst(SX1276_REG_MODEM_CONFIG_1, profile.modem, sizeof(profile.modem));
+
+    // Set auto AGC
+    writeRegister(SX1276_REG_MODEM_CONFIG_3, 0x04);
+
+    // SF6 needs dedicated detection settings
+    writeRegister(SX1276_REG_DETECTION_OPTIMIZE, profile.detectionOptimize);
+    writeRegister(SX1276_REG_DETECTION_THRESHOLD, profile.detectionThreshold);
+
+    writeRegister(SX1276_REG_SYNC_WORD, profile.syncWord);
+
+    // Set DIO0 to TxDone/RxDone
+    writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
+
+    // Keep the settings in sync for the setters
+    _modulation = SX1276_MODULATION_LORA;
+    _freq = profile.freq;
+    _power = profile.power;
+    _useBoost = profile.useBoost;
+    _bw = bw;
+    _sf = sf;
+    _cr = cr;
+    _preambleLength = ((uint16_t)profile.modem[3] << 8) | profile.modem[4];
+    _syncWord = profile.syncWord;
+    _crcEnabled = (profile.modem[1] & 0x04) != 0;
+    
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Apply a LoRa configuration profile in program memory
+ */
+int16_t SX1276::applyProfile_P(const SX1276LoRaProfile* profile) {
+    SX1276LoRaProfile copy;
+    SX1276Hal::readProgmem(&copy, profile, sizeof(copy));
+    return applyProfile(copy);
+}
+#endif
+
+/**
+ * Set carrier frequency
+ */
+int16_t SX1276::setFrequency(long freq) {
+    // Check frequency range (137-1020 MHz)
+    if (freq < 137000000L || freq > 1020000000L) {
+        return SX1276_ERR_INVALID_FREQUENCY;
+    }
+    
+    _freq = freq;
+    
+    // Calculate and write frequency register value
+    writeFrf(frequencyToFrf(freq));
+    
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Write the frequency registers (MSB, MID, LSB in one burst)
+ */
+void SX1276::writeFrf(uint32_t frf) {
+    uint8_t frfBytes[3];
+    frfBytes[0] = (frf >> 16) & 0xFF;
+    frfBytes[1] = (frf >> 8) & 0xFF;
+    frfBytes[2] = frf & 0xFF;
+    writeRegisterBurst(SX1276_REG_FRF_MSB, frfBytes, sizeof(frfBytes));
+}
+
+/**
+ * Convert a frequency in Hz to the FRF register value
+ * FRF = (Freq × 2^19) / FXOSC
+ */
+uint32_t SX1276::frequencyToFrf(uint32_t freq) {
+    return SX1276Reg::frf(freq);
+}
+
+/**
+ * Set channel plan (FRF values in RAM)
+ */
+void SX1276::setChannelPlan(const uint32_t* frf, uint8_t count) {
+    _channelPlan = frf;
+    _channelCount = count;
+    _channelPlanP = false;
+#ifdef LORA_ENABLED
+    if (count == 0) {
+        // Nothing left to hop over
+        stopHopping();
+    }
+#endif
+}
+
+/**
+ * Set channel plan (FRF values in program memory)
+ */
+void SX1276::setChannelPlan_P(const uint32_t* frf, uint8_t count) {
+    _channelPlan = frf;
+    _channelCount = count;
+    _channelPlanP = true;
+#ifdef LORA_ENABLED
+    if (count == 0) {
+        // Nothing left to hop over
+        stopHopping();
+    }
+#endif
+}
+
+/**
+ * Tune to a channel of the channel plan
+ * The synthesizer retunes when FRF_LSB is written, so FSTX/FSRX can stay
+ * active - only the PLL lock time is spent (no standby round trip).
+ */
+int16_t SX1276::hopTo(uint8_t channel) {
+    if (channel >= _channelCount) {
+        return SX1276_ERR_INVALID_FREQUENCY;
+    }
+
+    uint32_t frf = channelFrf(channel);
+
+    // TX/RX/CAD would be disturbed by the retuning
+    uint8_t mode = getMode();
+    if (mode != SX1276_MODE_STDBY && mode != SX1276_MODE_FSTX && mode != SX1276_MODE_FSRX) {
+        int16_t state = standby();
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+        mode = SX1276_MODE_STDBY;
+    }
+
+    writeFrf(frf);
+    _freq = SX1276Reg::frfToFrequency(frf);
+
+    if (mode == SX1276_MODE_STDBY) {
+        return SX1276_ERR_NONE;
+    }
+
+#ifdef FSK_OOK_ENABLED
+    if (_modulation != SX1276_MODULATION_LORA) {
+        // Wait for PllLock (bounded like ModeReady)
+        uint32_t start = SX1276Hal::micros();
+        while (!(readRegister(SX1276_REG_IRQ_FLAGS_1) & SX1276_IRQ1_PLL_LOCK)) {
+            if (SX1276Hal::micros() - start > SX1276_MODE_READY_TIMEOUT_US) {
+                return SX1276_ERR_MODE_TIMEOUT;
             }
-            paDac = 0x87;
-            power -= 3;
-        } else if (power < 2) {
-            power = 2;
         }
-        paConfig = SX1276_PA_BOOST | (power - 2);
+        return SX1276_ERR_NONE;
+    }
+#endif
+
+    // LoRa: no PllLock flag - wait for the datasheet lock time
+    SX1276Hal::delayMicroseconds(SX1276_TS_FS_US);
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * FRF value of a channel plan entry
+ */
+uint32_t SX1276::channelFrf(uint8_t channel) {
+    uint32_t frf;
+    if (_channelPlanP) {
+        SX1276Hal::readProgmem(&frf, &_channelPlan[channel], sizeof(frf));
     } else {
-        // RFO pin
-        if (power > 14) {
-            power = 14;
-        } else if (power < -1) {
-            power = -1;
+        frf = _channelPlan[channel];
+    }
+    return frf;
+}
+
+#ifdef LORA_ENABLED
+/**
+ * Enable LoRa frequency hopping over the channel plan
+ */
+int16_t SX1276::setFrequencyHopping(uint8_t hopPeriod) {
+    if (_modulation != SX1276_MODULATION_LORA) {
+        return SX1276_ERR_WRONG_MODEM;
+    }
+    if (hopPeriod != 0 && _channelCount == 0) {
+        return SX1276_ERR_INVALID_FREQUENCY;
+    }
+
+    writeRegister(SX1276_REG_HOP_PERIOD, hopPeriod);
+    _hopPeriod = hopPeriod;
+
+    // Packets start on channel 0
+    return (hopPeriod != 0) ? hopTo(0) : SX1276_ERR_NONE;
+}
+
+/**
+ * Switch frequency hopping off
+ */
+void SX1276::stopHopping() {
+    // HOP_PERIOD is in the LoRa register bank: in FSK/OOK mode, config()
+    // clears it when switching back to LoRa
+    if (_hopPeriod != 0 && _modulation == SX1276_MODULATION_LORA) {
+        writeRegister(SX1276_REG_HOP_PERIOD, 0);
+        _hopPeriod = 0;
+    }
+}
+
+/**
+ * Service a FhssChangeChannel event
+ * FhssPresentChannel is the hop count of the current packet (6 bits), the
+ * FRF of the corresponding channel must be written before the next hop.
+ */
+bool SX1276::serviceHopping() {
+    if (_channelCount == 0) {
+        return false;
+    }
+    
+    if (_dio1Pin >= 0) {
+        if (SX1276Hal::digitalRead(_dio1Pin) == LOW) {
+            return false;
         }
-        paConfig = SX1276_MAX_POWER | (power + 1);
+    } else if (!(readRegister(SX1276_REG_IRQ_FLAGS) & SX1276_IRQ_FHSS_CHANGE_CHANNEL)) {
+        return false;
+    }
+
+    uint8_t channel = (readRegister(SX1276_REG_HOP_CHANNEL) & 0x3F) % _channelCount;
+    writeFrf(channelFrf(channel));
+    writeRegister(SX1276_REG_IRQ_FLAGS, SX1276_IRQ_FHSS_CHANGE_CHANNEL);
+    return true;
+}
+#endif
+
+/**
+ * Get carrier frequency from the FRF registers
+ * Freq = FSTEP × FRF
+ */
+uint32_t SX1276::getFrequency() {
+    uint8_t frfBytes[3];
+    readRegisterBurst(SX1276_REG_FRF_MSB, frfBytes, sizeof(frfBytes));
+    uint32_t frf = ((uint32_t)frfBytes[0] << 16) | ((uint32_t)frfBytes[1] << 8) | frfBytes[2];
+    return SX1276Reg::frfToFrequency(frf);
+}
+
+/**
+ * Set SPI clock frequency
+ */
+void SX1276::setSpiFrequency(uint32_t freq) {
+    if (freq > SX1276_SPI_MAX_FREQUENCY) {
+        freq = SX1276_SPI_MAX_FREQUENCY;
     }
+    _spiSettings = SX1276Hal::SpiSettings(freq, MSBFIRST, SPI_MODE0);
+}
+
+/**
+ * Set output power
+ */
+int16_t SX1276::setPower(int8_t power, bool useBoost) {
+    _power = power;
+    _useBoost = useBoost;
+    
+    uint8_t paConfig;
+    uint8_t paDac;
+    powerToPaConfig(power, useBoost, paConfig, paDac);
     
     writeRegister(SX1276_REG_PA_CONFIG, paConfig);
     writeRegister(SX1276_REG_PA_DAC, paDac);
@@ -503,25 +1051,114 @@ int16_t SX1276::setPower(int8_t power, bool useBoost) {
     return SX1276_ERR_NONE;
 }
 
+/**
+ * Compute PA_CONFIG and PA_DAC for an output power
+ */
+void SX1276::powerToPaConfig(int8_t power, bool useBoost, uint8_t& paConfig, uint8_t& paDac) {
+    paConfig = SX1276Reg::paConfig(power, useBoost);
+    paDac = SX1276Reg::paDac(power, useBoost);
+}
+
 /**
  * Transmit data
  */
 int16_t SX1276::transmit(const uint8_t* data, size_t len) {
-    if (len > SX1276_MAX_PACKET_LENGTH) {
-        return SX1276_ERR_PACKET_TOO_LONG;
+    SX1276_STATS_SCOPE(SX1276_STATS_TRANSMIT);
+
+    int16_t state = startTransmit(data, len);
+    if (state != SX1276_ERR_NONE) {
+        return state;
     }
     
-    // Set to standby mode
-    int16_t state = standby();
+    // Wait for TX done on DIO0 (with timeout, restarted on each hop)
+    uint32_t start = SX1276Hal::millis();
+    while (SX1276Hal::digitalRead(_dio0Pin) == LOW) {
+#ifdef LORA_ENABLED
+        if (_modulation == SX1276_MODULATION_LORA && _hopPeriod != 0 && serviceHopping()) {
+            start = SX1276Hal::millis();
+        }
+#endif
+#ifdef FSK_OOK_ENABLED
+        refillFifo();
+#endif
+        if (SX1276Hal::millis() - start > 5000) {
+            finishTransmit();
+            return SX1276_ERR_TX_TIMEOUT;
+        }
+        SX1276Hal::yield();
+    }
+    
+    return finishTransmit();
+}
+
+/**
+ * Start transmitting data (non-blocking)
+ */
+int16_t SX1276::startTransmit(const uint8_t* data, size_t len) {
+    int16_t state = loadTransmit(data, len, false);
     if (state != SX1276_ERR_NONE) {
         return state;
     }
+    return enterTransmit();
+}
+
+#ifdef SX1276_ASYNC_FIFO
+/**
+ * Start transmitting data with the FIFO loaded in the background
+ */
+int16_t SX1276::startTransmitAsync(const uint8_t* data, size_t len) {
+    if (_fifoBusy) {
+        return SX1276_ERR_BUSY;
+    }
+    
+    int16_t state = loadTransmit(data, len, true);
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+    
+    // TX is entered by isFifoTransferDone() once the payload is in the FIFO
+    // (right away if the backend has no background transfer)
+    _txPending = true;
+    if (isFifoTransferDone()) {
+        state = _txError;
+        _txError = SX1276_ERR_NONE;
+    }
+    return state;
+}
+#endif
+
+/**
+ * Set up the chip for transmission and load the FIFO (in standby)
+ * @param background Load the FIFO with a background transfer (SX1276_ASYNC_FIFO)
+ */
+int16_t SX1276::loadTransmit(const uint8_t* data, size_t len, bool background) {
+#ifndef SX1276_ASYNC_FIFO
+    (void)background;
+#endif
+    size_t maxLen = SX1276_MAX_PACKET_LENGTH;
+#ifdef FSK_OOK_ENABLED
+    if (_modulation != SX1276_MODULATION_LORA && _fixedLength) {
+        maxLen = SX1276_MAX_PACKET_LENGTH_FSK;
+    }
+#endif
+    if (len > maxLen) {
+        return SX1276_ERR_PACKET_TOO_LONG;
+    }
+    
+    // Set to standby mode (unless the synthesizer is already locked, see prepareTransmit())
+    int16_t state = SX1276_ERR_NONE;
+    if (getMode() != SX1276_MODE_FSTX) {
+        state = standby();
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+    }
     
 #ifdef LORA_ENABLED
     if (_modulation == SX1276_MODULATION_LORA) {
         // LoRa mode transmit
-        // Set DIO0 to TxDone
-        writeRegister(SX1276_REG_DIO_MAPPING_1, 0x40);
+        // Set DIO0 to TxDone (and DIO1 to FhssChangeChannel when hopping)
+        writeRegister(SX1276_REG_DIO_MAPPING_1, (_hopPeriod != 0) ? 0x50 : 0x40);
         
         // Clear IRQ flags
         writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
@@ -529,80 +1166,62 @@ int16_t SX1276::transmit(const uint8_t* data, size_t len) {
         // Set FIFO pointer to TX base
         writeRegister(SX1276_REG_FIFO_ADDR_PTR, 0x00);
         
-        // Write data to FIFO
-        spiBegin();
-        spiTransfer(SX1276_REG_FIFO | 0x80);
-        for (size_t i = 0; i < len; i++) {
-            spiTransfer(data[i]);
-        }
-        spiEnd();
-        
         // Set payload length
         writeRegister(SX1276_REG_PAYLOAD_LENGTH, len);
         
-        // Start transmission
-        state = setMode(SX1276_MODE_TX);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-        
-        // Wait for TX done (with timeout)
-        uint32_t start = millis();
-        while (digitalRead(_dio0Pin) == LOW) {
-            if (millis() - start > 5000) {
-                standby();
-                return SX1276_ERR_TX_TIMEOUT;
-            }
-            yield();
+        // Write data to FIFO
+#ifdef SX1276_ASYNC_FIFO
+        if (background) {
+            return startFifoWrite(data, len);
         }
-        
-        // Clear IRQ flags
-        writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
-        
-        // Set back to standby
-        state = standby();
+#endif
+        writeRegisterBurst(SX1276_REG_FIFO, data, len);
     }
 #endif
 
 #ifdef FSK_OOK_ENABLED
     if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
         // FSK/OOK mode transmit
-        // Set payload length register (used for both fixed and variable modes)
-        writeRegister(SX1276_REG_PAYLOAD_LENGTH_FSK, len);
-        
-        // Write data to FIFO
-        spiBegin();
-        spiTransfer(SX1276_REG_FIFO | 0x80);
+        // Set DIO0 to PacketSent and DIO1 to FifoLevel
+        writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
         
-        // For variable length mode, write length byte first
-        if (!_fixedLength) {
-            spiTransfer(len);
+        // Fixed length mode: 11-bit payload length in PACKET_CONFIG_2 and PAYLOAD_LENGTH
+        // (variable length mode sends the length byte, PAYLOAD_LENGTH is the RX limit)
+        if (_fixedLength && len != _payloadLengthFSK) {
+            setPayloadLength(len);
         }
         
-        // Write payload data
-        for (size_t i = 0; i < len; i++) {
-            spiTransfer(data[i]);
+        // Write as much payload data as fits (after the length byte in variable
+        // length mode), the rest is streamed (see refillFifo())
+        size_t fill = _fixedLength ? SX1276_FIFO_SIZE_FSK : SX1276_FIFO_SIZE_FSK - 1;
+        if (fill > len) {
+            fill = len;
         }
-        spiEnd();
         
-        // Start transmission
-        state = setMode(SX1276_MODE_TX);
-        if (state != SX1276_ERR_NONE) {
-            return state;
+        _txData = data + fill;
+        _txRemaining = len - fill;
+        if (_txRemaining != 0) {
+            _fifoPollUs = (SX1276_FIFO_POLL_BYTES * 8000000UL) / _bitrate;
+            _fifoPollTime = SX1276Hal::micros();
         }
         
-        // Wait for TX done (PacketSent flag in IRQ_FLAGS_2)
-        uint32_t start = millis();
-        while (!(readRegister(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_PACKET_SENT)) {
-            if (millis() - start > 5000) {
-                standby();
-                return SX1276_ERR_TX_TIMEOUT;
+#ifdef SX1276_ASYNC_FIFO
+        if (background) {
+            if (!_fixedLength) {
+                writeRegister(SX1276_REG_FIFO, len);
             }
-            yield();
+            return startFifoWrite(data, fill);
         }
+#endif
         
-        // Set back to standby
-        state = standby();
+        // Write data to FIFO, for variable length mode the length byte first
+        spiBegin();
+        spiTransfer(SX1276_REG_FIFO | 0x80);
+        if (!_fixedLength) {
+            spiTransfer(len);
+        }
+        spiWriteBuffer(data, fill);
+        spiEnd();
     }
 #endif
 
@@ -612,52 +1231,275 @@ int16_t SX1276::transmit(const uint8_t* data, size_t len) {
     (void)len;
 #endif
     
-    return state;
+    return SX1276_ERR_NONE;
 }
 
 /**
- * Receive data (blocking)
+ * Start the transmission of the packet in the FIFO
  */
-int16_t SX1276::receive(uint8_t* data, size_t maxLen) {
+int16_t SX1276::enterTransmit() {
+    _dio0Flag = false;
+    return setMode(SX1276_MODE_TX);
+}
+
+/**
+ * Check whether the transmission has completed
+ */
+bool SX1276::isTransmitDone() {
+#ifdef SX1276_ASYNC_FIFO
+    // startTransmitAsync(): payload still being loaded, or entering TX failed
+    if (_txPending && !isFifoTransferDone()) {
+        return false;
+    }
+    if (_txError != SX1276_ERR_NONE) {
+        return true;
+    }
+#endif
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA && _hopPeriod != 0) {
+        serviceHopping();
+    }
+#endif
+#ifdef FSK_OOK_ENABLED
+    refillFifo();
+#endif
+    // The pin level covers DIO0 pins without interrupt capability
+    return _dio0Flag || SX1276Hal::digitalRead(_dio0Pin) == HIGH;
+}
+
+/**
+ * Complete or abort the transmission
+ */
+int16_t SX1276::finishTransmit() {
+#ifdef SX1276_ASYNC_FIFO
+    // Aborted while startTransmitAsync() was loading the payload: the bus is
+    // busy until the transfer has ended, TX is not entered any more
+    _txPending = false;
+    while (!isFifoTransferDone()) {
+        SX1276Hal::yield();
+    }
+    if (_txError != SX1276_ERR_NONE) {
+        int16_t txError = _txError;
+        _txError = SX1276_ERR_NONE;
+        standby();
+        return txError;
+    }
+#endif
+    
+    bool done = _dio0Flag || SX1276Hal::digitalRead(_dio0Pin) == HIGH;
+    _dio0Flag = false;
+    
 #ifdef LORA_ENABLED
     if (_modulation == SX1276_MODULATION_LORA) {
-        // LoRa mode receive
-        // Set to standby mode
+        // The chip returns to standby by itself after TxDone
+        if (done) {
+            updateShadow(SX1276_REG_OP_MODE, (readShadow(SX1276_REG_OP_MODE) & ~0x07) | SX1276_MODE_STDBY);
+        }
+        
+        // Clear IRQ flags
+        writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
+        
+        // Set back to standby (no-op after TxDone)
         int16_t state = standby();
+        
+        // Next packet starts on channel 0 again
+        if (_hopPeriod != 0 && state == SX1276_ERR_NONE) {
+            state = hopTo(0);
+        }
+        return state;
+    }
+#endif
+    
+    (void)done;
+    
+#ifdef FSK_OOK_ENABLED
+    _txRemaining = 0;
+#endif
+    
+    // FSK/OOK: PacketSent is cleared when leaving TX
+    return standby();
+}
+
+/**
+ * DIO0 interrupt handlers, one per slot in _isrInstances
+ */
+void SX1276_ISR_ATTR SX1276::dio0Isr0() {
+    SX1276* radio = _isrInstances[0];
+    if (radio != nullptr) {
+        radio->_dio0Flag = true;
+    }
+}
+
+#if SX1276_MAX_INSTANCES > 1
+void SX1276_ISR_ATTR SX1276::dio0Isr1() {
+    SX1276* radio = _isrInstances[1];
+    if (radio != nullptr) {
+        radio->_dio0Flag = true;
+    }
+}
+#endif
+
+#if SX1276_MAX_INSTANCES > 2
+void SX1276_ISR_ATTR SX1276::dio0Isr2() {
+    SX1276* radio = _isrInstances[2];
+    if (radio != nullptr) {
+        radio->_dio0Flag = true;
+    }
+}
+#endif
+
+#if SX1276_MAX_INSTANCES > 3
+void SX1276_ISR_ATTR SX1276::dio0Isr3() {
+    SX1276* radio = _isrInstances[3];
+    if (radio != nullptr) {
+        radio->_dio0Flag = true;
+    }
+}
+#endif
+
+/**
+ * Receive data (blocking)
+ */
+int16_t SX1276::receive(uint8_t* data, size_t maxLen) {
+    SX1276_STATS_SCOPE(SX1276_STATS_RECEIVE);
+
+    int16_t state = startReceive();
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+    
+#ifdef FSK_OOK_ENABLED
+    if (_modulation != SX1276_MODULATION_LORA) {
+        // Drain the FIFO during reception if the packet may not fit
+        _rxData = data;
+        _rxMaxLen = (maxLen < 0xFFFF) ? maxLen : 0xFFFF;
+        _rxLen = _fixedLength ? _payloadLengthFSK : SX1276_LENGTH_UNKNOWN;
+        _rxRead = 0;
+        _rxStreaming = !_fixedLength || _rxLen > SX1276_FIFO_SIZE_FSK;
+        _fifoPollUs = (SX1276_FIFO_POLL_BYTES * 8000000UL) / _bitrate;
+        _fifoPollTime = SX1276Hal::micros();
+    }
+#endif
+    
+    // Wait for RxDone/PayloadReady on DIO0 (with timeout, restarted on each hop)
+    uint32_t start = SX1276Hal::millis();
+    while (SX1276Hal::digitalRead(_dio0Pin) == LOW) {
+#ifdef LORA_ENABLED
+        if (_modulation == SX1276_MODULATION_LORA && _hopPeriod != 0 && serviceHopping()) {
+            start = SX1276Hal::millis();
+        }
+#endif
+#ifdef FSK_OOK_ENABLED
+        drainFifo();
+#endif
+        if (SX1276Hal::millis() - start > 10000) {
+#ifdef FSK_OOK_ENABLED
+            _rxStreaming = false;
+#endif
+            standby();
+            return SX1276_ERR_RX_TIMEOUT;
+        }
+        SX1276Hal::yield();
+    }
+    
+    return readData(data, maxLen);
+}
+
+/**
+ * Start listening for a packet (non-blocking)
+ */
+int16_t SX1276::startReceive() {
+    // Set to standby mode (unless the synthesizer is already locked, see prepareReceive())
+    int16_t state = SX1276_ERR_NONE;
+    if (getMode() != SX1276_MODE_FSRX) {
+        state = standby();
         if (state != SX1276_ERR_NONE) {
             return state;
         }
-        
-        // Set DIO0 to RxDone
-        writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
+    }
+    
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA) {
+        // LoRa mode receive
+        // Set DIO0 to RxDone (and DIO1 to FhssChangeChannel when hopping)
+        writeRegister(SX1276_REG_DIO_MAPPING_1, (_hopPeriod != 0) ? 0x10 : 0x00);
         
         // Clear IRQ flags
         writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
         
         // Set FIFO pointer to RX base
         writeRegister(SX1276_REG_FIFO_ADDR_PTR, 0x00);
+    }
+#endif
+
+#ifdef FSK_OOK_ENABLED
+    if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
+        // FSK/OOK mode receive
+        // Debug: verify critical registers before RX
+        SX1276_DEBUG_PRINT(F("Before RX: PKT_CFG1=0x"));
+        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PACKET_CONFIG_1), HEX);
+        SX1276_DEBUG_PRINT(F(", PKT_CFG2=0x"));
+        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PACKET_CONFIG_2), HEX);
+        SX1276_DEBUG_PRINT(F(", PAYLOAD_LEN="));
+        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PAYLOAD_LENGTH_FSK));
+        SX1276_DEBUG_PRINT(F(", SEQ_CFG1=0x"));
+        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_SEQ_CONFIG_1), HEX);
+        SX1276_DEBUG_PRINT(F(", SEQ_CFG2=0x"));
+        SX1276_DEBUG_PRINTLN(readRegister(SX1276_REG_SEQ_CONFIG_2), HEX);
         
-        // Start reception
-        state = setMode(SX1276_MODE_RX_CONTINUOUS);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
+        // Set DIO0 to PayloadReady and DIO1 to FifoLevel
+        writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
         
-        // Wait for RX done (with timeout)
-        uint32_t start = millis();
-        while (digitalRead(_dio0Pin) == LOW) {
-            if (millis() - start > 10000) {
-                standby();
-                return SX1276_ERR_RX_TIMEOUT;
-            }
-            yield();
+        // Clear IRQ flags before starting reception
+        writeRegister(SX1276_REG_IRQ_FLAGS_1, 0xFF);
+        writeRegister(SX1276_REG_IRQ_FLAGS_2, 0xFF);
+        
+        // Whole packets are read after PayloadReady (see receive() for streaming)
+        _rxStreaming = false;
+    }
+#endif
+    
+    // Start reception in continuous mode
+    _dio0Flag = false;
+    return setMode(SX1276_MODE_RX_CONTINUOUS);
+}
+
+/**
+ * Check whether a packet has been received
+ */
+bool SX1276::isPacketAvailable() {
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA && _hopPeriod != 0) {
+        serviceHopping();
+    }
+#endif
+    // The pin level covers DIO0 pins without interrupt capability
+    return _dio0Flag || SX1276Hal::digitalRead(_dio0Pin) == HIGH;
+}
+
+/**
+ * Read the received packet
+ */
+int16_t SX1276::readData(uint8_t* data, size_t maxLen) {
+    if (!_dio0Flag && SX1276Hal::digitalRead(_dio0Pin) == LOW) {
+        return SX1276_ERR_NO_PACKET;
+    }
+    _dio0Flag = false;
+    
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA) {
+        // Leave RX first, so that a following packet cannot overwrite the FIFO
+        standby();
+        
+        // Next packet starts on channel 0 again
+        if (_hopPeriod != 0) {
+            hopTo(0);
         }
         
         // Check for CRC error
         uint8_t irqFlags = readRegister(SX1276_REG_IRQ_FLAGS);
         if (irqFlags & SX1276_IRQ_PAYLOAD_CRC_ERROR) {
             writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
-            standby();
             return SX1276_ERR_CRC_MISMATCH;
         }
         
@@ -672,16 +1514,60 @@ int16_t SX1276::receive(uint8_t* data, size_t maxLen) {
         writeRegister(SX1276_REG_FIFO_ADDR_PTR, fifoAddr);
         
         // Read data from FIFO
-        spiBegin();
-        spiTransfer(SX1276_REG_FIFO);
-        for (size_t i = 0; i < len; i++) {
-            data[i] = spiTransfer(0x00);
-        }
-        spiEnd();
+        readRegisterBurst(SX1276_REG_FIFO, data, len);
         
         // Clear IRQ flags
         writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
         
+        return len;
+    }
+#endif
+
+#ifdef FSK_OOK_ENABLED
+    if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
+        SX1276_DEBUG_PRINTLN(F("PayloadReady flag set"));
+        
+        // RSSI of the packet - the smoothed value still reflects the last bits
+        // right after PayloadReady
+        uint8_t rawRSSI = readRegister(SX1276_REG_RSSI_VALUE_FSK);
+        _lastRSSI = -((int16_t)rawRSSI / 2);
+        
+        SX1276_DEBUG_PRINT(F("RSSI read on PayloadReady: raw=0x"));
+        SX1276_DEBUG_PRINTLN(rawRSSI, HEX);
+        
+        // Check for CRC error (if enabled)
+        if (_crcOnFSK) {
+            uint8_t irqFlags2 = readRegister(SX1276_REG_IRQ_FLAGS_2);
+            if (!(irqFlags2 & SX1276_IRQ2_CRC_OK)) {
+                _rxStreaming = false;
+                standby();
+                return SX1276_ERR_CRC_MISMATCH;
+            }
+        }
+        
+        // Read the rest of the packet (receive() may have drained a part already)
+        if (!_rxStreaming) {
+            _rxLen = _fixedLength ? _payloadLengthFSK : SX1276_LENGTH_UNKNOWN;
+            _rxRead = 0;
+        }
+        _rxData = data;
+        _rxMaxLen = (maxLen < 0xFFFF) ? maxLen : 0xFFFF;
+        _rxStreaming = false;
+        readFifoPayload(0xFFFF);
+        uint16_t len = (_rxLen < _rxMaxLen) ? _rxLen : _rxMaxLen;
+        
+        // Debug: show first few bytes of received packet
+        SX1276_DEBUG_PRINT(F("Packet received, len="));
+        SX1276_DEBUG_PRINT(len);
+        SX1276_DEBUG_PRINT(F(", first bytes: "));
+        for (size_t i = 0; i < (len < 4 ? len : 4); i++) {
+            SX1276_DEBUG_PRINT(F("0x"));
+            if (data[i] < 0x10) SX1276_DEBUG_PRINT(F("0"));
+            SX1276_DEBUG_PRINT(data[i], HEX);
+            SX1276_DEBUG_PRINT(F(" "));
+        }
+        SX1276_DEBUG_PRINTLN();
+        
         // Set back to standby
         standby();
         
@@ -689,164 +1575,212 @@ int16_t SX1276::receive(uint8_t* data, size_t maxLen) {
     }
 #endif
 
+#if !defined(LORA_ENABLED) && !defined(FSK_OOK_ENABLED)
+    // Suppress unused parameter warnings when no modulation is enabled
+    (void)data;
+    (void)maxLen;
+#endif
+    
+    return SX1276_ERR_WRONG_MODEM;
+}
+
+#ifdef SX1276_ASYNC_FIFO
+/**
+ * Read the received packet with the FIFO drained in the background
+ */
+int16_t SX1276::readDataAsync(uint8_t* data, size_t maxLen) {
+    if (_fifoBusy) {
+        return SX1276_ERR_BUSY;
+    }
+    if (!_dio0Flag && SX1276Hal::digitalRead(_dio0Pin) == LOW) {
+        return SX1276_ERR_NO_PACKET;
+    }
+    _dio0Flag = false;
+    
+    size_t len = 0;
+    
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA) {
+        // Leave RX first, so that a following packet cannot overwrite the FIFO
+        standby();
+        
+        // Next packet starts on channel 0 again
+        if (_hopPeriod != 0) {
+            hopTo(0);
+        }
+        
+        // Check for CRC error
+        uint8_t irqFlags = readRegister(SX1276_REG_IRQ_FLAGS);
+        writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
+        if (irqFlags & SX1276_IRQ_PAYLOAD_CRC_ERROR) {
+            return SX1276_ERR_CRC_MISMATCH;
+        }
+        
+        len = readRegister(SX1276_REG_RX_NB_BYTES);
+        
+        // Set FIFO pointer to last packet
+        uint8_t fifoAddr = readRegister(SX1276_REG_FIFO_RX_CURRENT_ADDR);
+        writeRegister(SX1276_REG_FIFO_ADDR_PTR, fifoAddr);
+    }
+#endif
+
 #ifdef FSK_OOK_ENABLED
     if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
-        // FSK/OOK mode receive
-        // Set to standby mode
-        int16_t state = standby();
-        if (state != SX1276_ERR_NONE) {
-            return state;
+        uint8_t rawRSSI = readRegister(SX1276_REG_RSSI_VALUE_FSK);
+        _lastRSSI = -((int16_t)rawRSSI / 2);
+        
+        _rxStreaming = false;
+        if (_crcOnFSK && !(readRegister(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_CRC_OK)) {
+            standby();
+            return SX1276_ERR_CRC_MISMATCH;
         }
         
-        // Debug: verify critical registers before RX
-        SX1276_DEBUG_PRINT(F("Before RX: PKT_CFG1=0x"));
-        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PACKET_CONFIG_1), HEX);
-        SX1276_DEBUG_PRINT(F(", PKT_CFG2=0x"));
-        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PACKET_CONFIG_2), HEX);
-        SX1276_DEBUG_PRINT(F(", PAYLOAD_LEN="));
-        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_PAYLOAD_LENGTH_FSK));
-        SX1276_DEBUG_PRINT(F(", SEQ_CFG1=0x"));
-        SX1276_DEBUG_PRINT(readRegister(SX1276_REG_SEQ_CONFIG_1), HEX);
-        SX1276_DEBUG_PRINT(F(", SEQ_CFG2=0x"));
-        SX1276_DEBUG_PRINTLN(readRegister(SX1276_REG_SEQ_CONFIG_2), HEX);
+        // The packet is complete in the FIFO after PayloadReady, and standby
+        // keeps the FIFO content
+        standby();
         
-        // Clear IRQ flags before starting reception
-        writeRegister(SX1276_REG_IRQ_FLAGS_1, 0xFF);
-        writeRegister(SX1276_REG_IRQ_FLAGS_2, 0xFF);
+        // Variable length mode - first byte in FIFO is length
+        len = _fixedLength ? _payloadLengthFSK : readRegister(SX1276_REG_FIFO);
         
-        // Start reception in continuous mode
-        // With sequencer enabled (SEQ_CONFIG_1=0x00), RX_CONTINUOUS should work properly
-        state = setMode(SX1276_MODE_RX_CONTINUOUS);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
+        // The rest of a packet longer than the buffer is cleared afterwards
+        _rxTruncated = (len > maxLen);
+    }
+#endif
+
+    if (len > maxLen) {
+        len = maxLen;
+    }
+    
+    int16_t state = startFifoRead(data, len);
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+    
+    // Completes right away if the backend has no background transfer
+    isFifoTransferDone();
+    return len;
+}
+#endif
+
+#ifdef SX1276_RX_QUEUE
+/**
+ * Continuous reception: take received packets from the chip into the queue
+ */
+uint8_t SX1276::available() {
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA && _hopPeriod != 0) {
+        serviceHopping();
+    }
+#endif
+    if (getMode() == SX1276_MODE_RX_CONTINUOUS &&
+        (_dio0Flag || SX1276Hal::digitalRead(_dio0Pin) == HIGH)) {
+        // Cleared first, so that a packet ending meanwhile sets it again
+        _dio0Flag = false;
+        queuePacket();
+    }
+    return _rxCount;
+}
+
+/**
+ * Take the oldest packet from the queue
+ */
+int16_t SX1276::readPacket(SX1276Packet& packet) {
+    if (_rxCount == 0 && available() == 0) {
+        return SX1276_ERR_NO_PACKET;
+    }
+    packet = _rxQueue[_rxHead];
+    _rxHead = (_rxHead + 1) % SX1276_RX_QUEUE_SIZE;
+    _rxCount--;
+    return packet.len;
+}
+
+/**
+ * Number of packets discarded because the queue was full
+ */
+uint16_t SX1276::getQueueOverflows() const {
+    return _rxOverflows;
+}
+
+/**
+ * Copy the packet signalled on DIO0 into the queue (the chip stays in RX)
+ */
+void SX1276::queuePacket() {
+    SX1276Packet* packet = nullptr;
+    if (_rxCount < SX1276_RX_QUEUE_SIZE) {
+        packet = &_rxQueue[(_rxHead + _rxCount) % SX1276_RX_QUEUE_SIZE];
+    }
+    
+#ifdef LORA_ENABLED
+    if (_modulation == SX1276_MODULATION_LORA) {
+        // FIFO_RX_CURRENT_ADDR, IRQ_FLAGS_MASK, IRQ_FLAGS and RX_NB_BYTES (0x10-0x13)
+        uint8_t status[4];
+        readRegisterBurst(SX1276_REG_FIFO_RX_CURRENT_ADDR, status, sizeof(status));
         
-        // Wait for PayloadReady flag (with timeout)
-        // Double protection: time-based (10s) and iteration-based (prevents infinite loop if millis() fails)
-        uint32_t start = millis();
-        uint32_t iterations = 0;
-        const uint32_t maxIterations = 10000000;  // Safety limit (~10M iterations at ~1us each = ~10s)
-        const uint32_t rssiCheckInterval = 50;  // Check for RSSI every 50 iterations (~50us)
-        bool rssiCaptured = false;  // Track if we've captured RSSI
+        // Clear the flags right away - DIO0 then rises again for the next packet
+        writeRegister(SX1276_REG_IRQ_FLAGS, 0xFF);
         
-        while (!(readRegister(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_PAYLOAD_READY)) {
-            if (millis() - start > 10000) {
-                standby();
-                return SX1276_ERR_RX_TIMEOUT;
-            }
-            if (++iterations > maxIterations) {
-                // Emergency timeout if millis() is not advancing
-                standby();
-                return SX1276_ERR_RX_TIMEOUT;
-            }
-            
-            // Read RSSI after sync address match (when RSSI is valid)
-            // Check periodically to reduce SPI traffic
-            if (!rssiCaptured && (iterations % rssiCheckInterval == 0)) {
-                uint8_t irqFlags1 = readRegister(SX1276_REG_IRQ_FLAGS_1);
-                if (irqFlags1 & SX1276_IRQ1_SYNC_ADDRESS_MATCH) {
-                    uint8_t rawRSSI = readRegister(SX1276_REG_RSSI_VALUE_FSK);
-                    _lastRSSI = -((int16_t)rawRSSI / 2);
-                    rssiCaptured = true;
-                    
-                    SX1276_DEBUG_PRINT(F("RSSI captured on sync match: raw=0x"));
-                    SX1276_DEBUG_PRINT(rawRSSI, HEX);
-                    SX1276_DEBUG_PRINT(F(", IRQ1=0x"));
-                    SX1276_DEBUG_PRINT(irqFlags1, HEX);
-                    SX1276_DEBUG_PRINT(F(", IRQ2=0x"));
-                    uint8_t irqFlags2 = readRegister(SX1276_REG_IRQ_FLAGS_2);
-                    SX1276_DEBUG_PRINTLN(irqFlags2, HEX);
-                }
-            }
-            
-            yield();
+        // Next packet starts on channel 0 again
+        if (_hopPeriod != 0) {
+            writeFrf(channelFrf(0));
         }
         
-        SX1276_DEBUG_PRINTLN(F("PayloadReady flag set"));
-        
-        // If RSSI wasn't captured during sync detection, read it now as a fallback
-        if (!rssiCaptured) {
-            uint8_t rawRSSI = readRegister(SX1276_REG_RSSI_VALUE_FSK);
-            _lastRSSI = -((int16_t)rawRSSI / 2);
-            
-            SX1276_DEBUG_PRINT(F("RSSI fallback read: raw=0x"));
-            SX1276_DEBUG_PRINT(rawRSSI, HEX);
-            SX1276_DEBUG_PRINT(F(", IRQ1=0x"));
-            uint8_t irqFlags1 = readRegister(SX1276_REG_IRQ_FLAGS_1);
-            SX1276_DEBUG_PRINTLN(irqFlags1, HEX);
+        if (!(status[2] & SX1276_IRQ_RX_DONE) || (status[2] & SX1276_IRQ_PAYLOAD_CRC_ERROR)) {
+            return;
         }
-        
-        // Check for CRC error (if enabled)
-        if (_crcOnFSK) {
-            uint8_t irqFlags2 = readRegister(SX1276_REG_IRQ_FLAGS_2);
-            if (!(irqFlags2 & SX1276_IRQ2_CRC_OK)) {
-                standby();
-                return SX1276_ERR_CRC_MISMATCH;
-            }
+        if (packet == nullptr) {
+            _rxOverflows++;
+            return;
         }
         
+        // Packets follow each other in the FIFO, the last one starts at FIFO_RX_CURRENT_ADDR
+        packet->len = (status[3] < SX1276_RX_QUEUE_PACKET_LENGTH) ? status[3] : SX1276_RX_QUEUE_PACKET_LENGTH;
+        writeRegister(SX1276_REG_FIFO_ADDR_PTR, status[0]);
+        readRegisterBurst(SX1276_REG_FIFO, packet->data, packet->len);
         
-        // Get packet length and read data
-        uint8_t len;
-        if (_fixedLength) {
-            // Fixed length mode - length is from register
-            len = readRegister(SX1276_REG_PAYLOAD_LENGTH_FSK);
-            if (len > maxLen) {
-                len = maxLen;
-            }
-            
-            // Read data from FIFO
-            spiBegin();
-            spiTransfer(SX1276_REG_FIFO);
-            for (size_t i = 0; i < len; i++) {
-                data[i] = spiTransfer(0x00);
-            }
-            spiEnd();
-        } else {
-            // Variable length mode - first byte in FIFO is length
-            // Read length and data in one transaction
-            spiBegin();
-            spiTransfer(SX1276_REG_FIFO);
-            len = spiTransfer(0x00);  // First byte is length
-            
-            if (len > maxLen) {
-                len = maxLen;
-            }
-            
-            // Read payload data
-            for (size_t i = 0; i < len; i++) {
-                data[i] = spiTransfer(0x00);
-            }
-            spiEnd();
+        // PKT_SNR_VALUE and PKT_RSSI_VALUE (0x19-0x1A)
+        uint8_t quality[2];
+        readRegisterBurst(SX1276_REG_PKT_SNR_VALUE, quality, sizeof(quality));
+        packet->snr = (int8_t)quality[0];
+        packet->rssi = ((_freq < 862000000L) ? -164 : -157) + quality[1];
+    }
+#endif
+
+#ifdef FSK_OOK_ENABLED
+    if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
+        uint8_t rawRSSI = readRegister(SX1276_REG_RSSI_VALUE_FSK);
+        bool crcOk = !_crcOnFSK || (readRegister(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_CRC_OK);
+        if (crcOk && packet == nullptr) {
+            _rxOverflows++;
         }
-        
-        // Debug: show first few bytes of received packet
-        SX1276_DEBUG_PRINT(F("Packet received, len="));
-        SX1276_DEBUG_PRINT(len);
-        SX1276_DEBUG_PRINT(F(", first bytes: "));
-        for (size_t i = 0; i < (len < 4 ? len : 4); i++) {
-            SX1276_DEBUG_PRINT(F("0x"));
-            if (data[i] < 0x10) SX1276_DEBUG_PRINT(F("0"));
-            SX1276_DEBUG_PRINT(data[i], HEX);
-            SX1276_DEBUG_PRINT(F(" "));
+        if (!crcOk) {
+            packet = nullptr;
         }
-        SX1276_DEBUG_PRINTLN();
         
-        // Set back to standby
-        standby();
+        // The FIFO must be read out in any case - the receiver restarts
+        // automatically (AutoRestartRxMode) once it is empty
+        _rxData = (packet != nullptr) ? packet->data : nullptr;
+        _rxMaxLen = (packet != nullptr) ? SX1276_RX_QUEUE_PACKET_LENGTH : 0;
+        _rxLen = _fixedLength ? _payloadLengthFSK : SX1276_LENGTH_UNKNOWN;
+        _rxRead = 0;
+        readFifoPayload(0xFFFF);
+        uint16_t stored = (_rxLen < _rxMaxLen) ? _rxLen : _rxMaxLen;
         
-        return len;
+        if (packet == nullptr) {
+            return;
+        }
+        packet->len = stored;
+        packet->snr = 0;
+        packet->rssi = -((int16_t)rawRSSI / 2);
+        _lastRSSI = packet->rssi;
     }
 #endif
 
-#if !defined(LORA_ENABLED) && !defined(FSK_OOK_ENABLED)
-    // Suppress unused parameter warnings when no modulation is enabled
-    (void)data;
-    (void)maxLen;
-#endif
-    
-    return SX1276_ERR_WRONG_MODEM;
+    if (packet != nullptr) {
+        packet->timestamp = SX1276Hal::millis();
+        _rxCount++;
+    }
 }
+#endif
 
 #ifdef LORA_ENABLED
 /**
@@ -860,8 +1794,8 @@ int16_t SX1276::setBandwidth(uint8_t bw) {
     
     _bw = bw;
     
-    // Read current config
-    uint8_t config1 = readRegister(SX1276_REG_MODEM_CONFIG_1);
+    // Read current config (from shadow cache if enabled)
+    uint8_t config1 = readShadow(SX1276_REG_MODEM_CONFIG_1);
     
     // Clear BW bits and set new value
     config1 = (config1 & 0x0F) | bw;
@@ -882,15 +1816,24 @@ int16_t SX1276::setSpreadingFactor(uint8_t sf) {
     
     _sf = sf;
     
-    // Read current config
-    uint8_t config2 = readRegister(SX1276_REG_MODEM_CONFIG_2);
+    // Read current config (from shadow cache if enabled)
+    uint8_t config2 = readShadow(SX1276_REG_MODEM_CONFIG_2);
     
     // Clear SF bits and set new value
     config2 = (config2 & 0x0F) | (sf << 4);
     
     writeRegister(SX1276_REG_MODEM_CONFIG_2, config2);
-    
-    // Set detection optimize and detection threshold for SF6
+
+    setDetectionOptimize(sf);
+
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Set detection optimize and detection threshold for the spreading factor
+ */
+void SX1276::setDetectionOptimize(uint8_t sf) {
+    // SF6 needs dedicated detection settings
     if (sf == SX1276_SF_6) {
         writeRegister(SX1276_REG_DETECTION_OPTIMIZE, 0x05);
         writeRegister(SX1276_REG_DETECTION_THRESHOLD, 0x0C);
@@ -898,8 +1841,6 @@ int16_t SX1276::setSpreadingFactor(uint8_t sf) {
         writeRegister(SX1276_REG_DETECTION_OPTIMIZE, 0x03);
         writeRegister(SX1276_REG_DETECTION_THRESHOLD, 0x0A);
     }
-    
-    return SX1276_ERR_NONE;
 }
 
 /**
@@ -913,8 +1854,8 @@ int16_t SX1276::setCodingRate(uint8_t cr) {
     
     _cr = cr;
     
-    // Read current config
-    uint8_t config1 = readRegister(SX1276_REG_MODEM_CONFIG_1);
+    // Read current config (from shadow cache if enabled)
+    uint8_t config1 = readShadow(SX1276_REG_MODEM_CONFIG_1);
     
     // Clear CR bits and set new value
     config1 = (config1 & 0xF1) | cr;
@@ -930,13 +1871,17 @@ int16_t SX1276::setCodingRate(uint8_t cr) {
  * Set preamble length (works for both LoRa and FSK/OOK modes)
  */
 int16_t SX1276::setPreambleLength(uint16_t len) {
+    // Preamble MSB and LSB are consecutive registers in both modes
+    uint8_t preamble[2];
+    preamble[0] = (len >> 8) & 0xFF;
+    preamble[1] = len & 0xFF;
+
 #ifdef LORA_ENABLED
     if (_modulation == SX1276_MODULATION_LORA) {
         _preambleLength = len;
-        
-        writeRegister(SX1276_REG_PREAMBLE_MSB, (len >> 8) & 0xFF);
-        writeRegister(SX1276_REG_PREAMBLE_LSB, len & 0xFF);
-        
+
+        writeRegisterBurst(SX1276_REG_PREAMBLE_MSB, preamble, sizeof(preamble));
+
         return SX1276_ERR_NONE;
     }
 #endif
@@ -944,10 +1889,9 @@ int16_t SX1276::setPreambleLength(uint16_t len) {
 #ifdef FSK_OOK_ENABLED
     if (_modulation == SX1276_MODULATION_FSK || _modulation == SX1276_MODULATION_OOK) {
         _preambleLengthFSK = len;
-        
-        writeRegister(SX1276_REG_PREAMBLE_MSB_FSK, (len >> 8) & 0xFF);
-        writeRegister(SX1276_REG_PREAMBLE_LSB_FSK, len & 0xFF);
-        
+
+        writeRegisterBurst(SX1276_REG_PREAMBLE_MSB_FSK, preamble, sizeof(preamble));
+
         return SX1276_ERR_NONE;
     }
 #endif
@@ -974,8 +1918,8 @@ int16_t SX1276::setSyncWord(uint8_t sw) {
 int16_t SX1276::setCRC(bool enable) {
     _crcEnabled = enable;
     
-    // Read current config
-    uint8_t config2 = readRegister(SX1276_REG_MODEM_CONFIG_2);
+    // Read current config (from shadow cache if enabled)
+    uint8_t config2 = readShadow(SX1276_REG_MODEM_CONFIG_2);
     
     if (enable) {
         config2 |= 0x04;
@@ -1085,33 +2029,272 @@ int16_t SX1276::sleep() {
  * Set operating mode
  */
 int16_t SX1276::setMode(uint8_t mode) {
+    SX1276_STATS_SCOPE(SX1276_STATS_SET_MODE);
+
     // Preserve modulation-select bits (LoRa / FSK-OOK) unless explicitly overridden.
     // This prevents unintended modulation changes when callers pass only SX1276_MODE_*.
     const uint8_t modulationMask = SX1276_LORA_MODE | SX1276_FSK_OOK_MODE;
+    uint8_t currentOpMode = (_mode != SX1276_MODE_UNKNOWN) ? _mode : readShadow(SX1276_REG_OP_MODE);
 
     // Modulation bits requested by the caller (if any).
     uint8_t requestedModulation = mode & modulationMask;
 
     if (requestedModulation == 0) {
         // Caller did not specify modulation bits: preserve current modulation.
-        uint8_t currentOpMode = readRegister(SX1276_REG_OP_MODE);
         requestedModulation = currentOpMode & modulationMask;
     }
 
     // Clear modulation bits from the passed mode and OR in the desired modulation.
     uint8_t newOpMode = (mode & ~modulationMask) | requestedModulation;
 
+    // Staying in FSK/OOK: keep ModulationType (bits 6-5), otherwise OOK is lost on every mode change
+    if (!(newOpMode & SX1276_LORA_MODE) && !(currentOpMode & SX1276_LORA_MODE)) {
+        newOpMode |= currentOpMode & 0x60;
+    }
+
+    // Nothing to do if the chip is known to be in this mode already
+    // (TX, RX single and CAD end by themselves and are always written)
+    if (newOpMode == _mode && isPersistentMode(newOpMode)) {
+        return SX1276_ERR_NONE;
+    }
+
     writeRegister(SX1276_REG_OP_MODE, newOpMode);
-    waitForModeReady();
-    return SX1276_ERR_NONE;
+    return waitForModeReady(currentOpMode, newOpMode);
+}
+
+/**
+ * Lock the synthesizer on the TX frequency (FSTX)
+ */
+int16_t SX1276::prepareTransmit() {
+    return setMode(SX1276_MODE_FSTX);
+}
+
+/**
+ * Lock the synthesizer on the RX frequency (FSRX)
+ */
+int16_t SX1276::prepareReceive() {
+    return setMode(SX1276_MODE_FSRX);
+}
+
+/**
+ * Get current operating mode
+ */
+uint8_t SX1276::getMode() const {
+    return (_mode == SX1276_MODE_UNKNOWN) ? SX1276_MODE_UNKNOWN : (_mode & 0x07);
+}
+
+/**
+ * Check whether the chip stays in a mode until it is changed via SPI
+ */
+bool SX1276::isPersistentMode(uint8_t opMode) {
+    uint8_t mode = opMode & 0x07;
+    return mode != SX1276_MODE_TX && mode != SX1276_MODE_RX_SINGLE && mode != SX1276_MODE_CAD;
+}
+
+/**
+ * Check whether the synthesizer stays locked between two modes
+ * (FSTX/TX use the TX frequency, FSRX/RX/CAD the RX frequency)
+ */
+bool SX1276::samePllSide(uint8_t from, uint8_t to) {
+    bool fromTx = (from == SX1276_MODE_FSTX || from == SX1276_MODE_TX);
+    bool toTx = (to == SX1276_MODE_FSTX || to == SX1276_MODE_TX);
+    bool fromRx = (from >= SX1276_MODE_FSRX);
+    bool toRx = (to >= SX1276_MODE_FSRX);
+    return (fromTx && toTx) || (fromRx && toRx);
 }
 
 /**
  * Wait for mode to be ready
+ * FSK/OOK: poll ModeReady in IRQ_FLAGS_1 (bounded by SX1276_MODE_READY_TIMEOUT_US,
+ * plus the receiver wake-up time when entering RX)
+ * LoRa: there is no ModeReady flag - wait for the datasheet transition time
+ */
+int16_t SX1276::waitForModeReady(uint8_t previous, uint8_t opMode) {
+    uint8_t from = previous & 0x07;
+    uint8_t to = opMode & 0x07;
+
+    if (opMode & SX1276_LORA_MODE) {
+        uint16_t wait = 0;
+        if (from == SX1276_MODE_SLEEP && to != SX1276_MODE_SLEEP) {
+            wait += SX1276_TS_OSC_US;
+        }
+        if (to >= SX1276_MODE_FSTX && !samePllSide(from, to)) {
+            wait += SX1276_TS_FS_US;
+        }
+        if (to == SX1276_MODE_TX || to >= SX1276_MODE_RX_CONTINUOUS) {
+            wait += SX1276_TS_TR_US;
+        }
+        if (wait > 0) {
+            SX1276Hal::delayMicroseconds(wait);
+        }
+        return SX1276_ERR_NONE;
+    }
+
+    // The receiver takes milliseconds at narrow bandwidths - poll at 1/32 of that
+    uint32_t timeout = SX1276_MODE_READY_TIMEOUT_US;
+    uint32_t interval = 0;
+#ifdef FSK_OOK_ENABLED
+    if (to >= SX1276_MODE_RX_CONTINUOUS) {
+        uint32_t wakeup = rxWakeupTimeUs();
+        timeout += 2 * wakeup;
+        interval = wakeup / 32;
+    }
+#endif
+
+    uint32_t start = SX1276Hal::micros();
+    while (!(readRegister(SX1276_REG_IRQ_FLAGS_1) & SX1276_IRQ1_MODE_READY)) {
+        if (SX1276Hal::micros() - start > timeout) {
+            return SX1276_ERR_MODE_TIMEOUT;
+        }
+        if (interval > 0) {
+            SX1276Hal::delayMicroseconds(interval);
+        }
+    }
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Read the on-chip temperature sensor
+ */
+int16_t SX1276::getTemperature(int8_t& temperature) {
+    uint8_t savedOpMode;
+    int16_t state = enterFskStandby(savedOpMode);
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+
+    state = measureTemperature(temperature);
+    int16_t restore = leaveFskStandby(savedOpMode);
+    return (state != SX1276_ERR_NONE) ? state : restore;
+}
+
+/**
+ * Run image and RSSI calibration if the temperature or the band has changed
+ * The calibration takes about 10 ms, the check only one temperature measurement.
+ */
+int16_t SX1276::calibrateImage(bool force) {
+    _calTime = 0;
+
+    uint8_t savedOpMode;
+    int16_t state = enterFskStandby(savedOpMode);
+    if (state != SX1276_ERR_NONE) {
+        return state;
+    }
+
+    int8_t temperature;
+    state = measureTemperature(temperature);
+    uint8_t band = frequencyBand(_freq);
+    int16_t drift = (int16_t)temperature - _calTemp;
+    if (drift < 0) {
+        drift = -drift;
+    }
+
+    if (state == SX1276_ERR_NONE && (force || band != _calBand || drift >= _calThreshold)) {
+        // ImageCalStart in FSK/OOK standby, done when ImageCalRunning clears
+        uint32_t start = SX1276Hal::micros();
+        writeRegister(SX1276_REG_IMAGE_CAL, readRegister(SX1276_REG_IMAGE_CAL) | SX1276_IMAGE_CAL_START);
+        while (readRegister(SX1276_REG_IMAGE_CAL) & SX1276_IMAGE_CAL_RUNNING) {
+            if (SX1276Hal::micros() - start > SX1276_IMAGE_CAL_TIMEOUT_US) {
+                state = SX1276_ERR_MODE_TIMEOUT;
+                break;
+            }
+            SX1276Hal::yield();
+        }
+        _calTime = SX1276Hal::micros() - start;
+
+        if (state == SX1276_ERR_NONE) {
+            _calTemp = temperature;
+            _calBand = band;
+        }
+    }
+
+    int16_t restore = leaveFskStandby(savedOpMode);
+    return (state != SX1276_ERR_NONE) ? state : restore;
+}
+
+/**
+ * Set the temperature drift for recalibration
+ */
+void SX1276::setCalibrationThreshold(uint8_t degrees) {
+    _calThreshold = degrees;
+}
+
+/**
+ * Get the duration of the last image calibration
+ */
+uint32_t SX1276::getCalibrationTime() const {
+    return _calTime;
+}
+
+/**
+ * Switch to FSK/OOK standby (temperature sensor and image calibration live in the FSK/OOK page)
+ * @param savedOpMode OP_MODE to restore with leaveFskStandby()
+ */
+int16_t SX1276::enterFskStandby(uint8_t& savedOpMode) {
+    savedOpMode = readShadow(SX1276_REG_OP_MODE);
+
+    if (savedOpMode & SX1276_LORA_MODE) {
+        // LongRangeMode can only be changed in sleep mode
+        int16_t state = setMode(SX1276_MODE_SLEEP);
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+        writeRegister(SX1276_REG_OP_MODE, (savedOpMode & 0x08) | SX1276_MODE_SLEEP);  // Keep LowFrequencyModeOn
+    }
+    return setMode(SX1276_MODE_STDBY);
+}
+
+/**
+ * Return from FSK/OOK standby to the saved modem (standby, or sleep if it was sleeping)
+ */
+int16_t SX1276::leaveFskStandby(uint8_t savedOpMode) {
+    bool sleeping = (savedOpMode & 0x07) == SX1276_MODE_SLEEP;
+
+    if (savedOpMode & SX1276_LORA_MODE) {
+        int16_t state = setMode(SX1276_MODE_SLEEP);
+        if (state != SX1276_ERR_NONE) {
+            return state;
+        }
+        writeRegister(SX1276_REG_OP_MODE, (savedOpMode & ~0x07) | SX1276_MODE_SLEEP);
+        if (sleeping) {
+            return SX1276_ERR_NONE;
+        }
+    }
+    return setMode(sleeping ? SX1276_MODE_SLEEP : SX1276_MODE_STDBY);
+}
+
+/**
+ * Measure the temperature (FSK/OOK standby)
+ * The sensor converts in FSRX with TempMonitorOff = 0: -1 degree C per LSB
+ */
+int16_t SX1276::measureTemperature(int8_t& temperature) {
+    uint8_t imageCal = readRegister(SX1276_REG_IMAGE_CAL);
+    if (imageCal & SX1276_TEMP_MONITOR_OFF) {
+        writeRegister(SX1276_REG_IMAGE_CAL, imageCal & ~SX1276_TEMP_MONITOR_OFF);
+    }
+
+    int16_t state = setMode(SX1276_MODE_FSRX);
+    if (state == SX1276_ERR_NONE) {
+        SX1276Hal::delayMicroseconds(SX1276_TEMP_MEASURE_US);
+        state = setMode(SX1276_MODE_STDBY);
+    }
+
+    if (imageCal & SX1276_TEMP_MONITOR_OFF) {
+        writeRegister(SX1276_REG_IMAGE_CAL, imageCal);
+    }
+    temperature = -(int8_t)readRegister(SX1276_REG_TEMP);
+    return state;
+}
+
+/**
+ * Frequency band for image calibration
+ * 1: 862-1020 MHz, 2: 410-525 MHz, 3: 137-175 MHz
  */
-void SX1276::waitForModeReady() {
-    // Small delay for mode switching
-    delay(2);
+uint8_t SX1276::frequencyBand(uint32_t freq) {
+    if (freq > 525000000UL) {
+        return 1;
+    }
+    return (freq > 175000000UL) ? 2 : 3;
 }
 
 #ifdef FSK_OOK_ENABLED
@@ -1119,154 +2302,221 @@ void SX1276::waitForModeReady() {
  * Configure FSK/OOK mode
  */
 int16_t SX1276::configFSK() {
-    int16_t state = SX1276_ERR_NONE;
-    
+    SX1276_STATS_SCOPE(SX1276_STATS_CONFIG_FSK);
+
     SX1276_DEBUG_PRINTLN(F("configFSK() start"));
     
-    // Follow RadioLib's approach for robust mode switching:
-    // 1. Go to sleep (preserving current modulation)
-    // 2. Change modulation bit
-    // 3. Continue with configuration in the new mode
-    
-    // Step 1: Go to sleep in current modulation
-    // Our setMode() preserves modulation bits when not explicitly specified
-    state = setMode(SX1276_MODE_SLEEP);
-    if (state != SX1276_ERR_NONE) {
-        return state;
+    // The bitrate is a divisor in the profile calculation - check it first
+    // (everything else is validated by applyProfile())
+    if (_bitrate < 1200 || _bitrate > 300000) {
+        return SX1276_ERR_INVALID_BITRATE;
     }
     
-    // Step 2: Now explicitly set FSK/OOK mode bit (bit 7 = 0)
-    // Read current OP_MODE and clear the LoRa bit
-    uint8_t opMode = readRegister(SX1276_REG_OP_MODE);
-    opMode &= ~SX1276_LORA_MODE;  // Clear bit 7 for FSK/OOK mode
-    writeRegister(SX1276_REG_OP_MODE, opMode);
-    delay(10);
-    
-    SX1276_DEBUG_PRINT(F("After setting FSK mode, OP_MODE=0x"));
-    SX1276_DEBUG_PRINTLN(readRegister(SX1276_REG_OP_MODE), HEX);
+    // Register image from the current settings, sync word copied from the buffer
+    SX1276FSKProfile profile(_freq, _bitrate, _freqDev, _rxBw, _power, _preambleLengthFSK,
+                             _modulation == SX1276_MODULATION_OOK, 0, _syncWordLen,
+                             _fixedLength, _crcOnFSK, _useBoost);
+    for (uint8_t i = 0; i < _syncWordLen && i < 8; i++) {
+        profile.sync[3 + i] = _syncWordFSK[i];
+    }
     
-    // Set modulation type (FSK or OOK)
-    opMode = readRegister(SX1276_REG_OP_MODE);
-    if (_modulation == SX1276_MODULATION_OOK) {
-        opMode |= 0x20;  // Set OOK bit
-    } else {
-        opMode &= ~0x20;  // Clear OOK bit for FSK
+    return applyProfile(profile);
+}
+
+/**
+ * Initialize in FSK/OOK mode from a configuration profile
+ */
+int16_t SX1276::begin(const SX1276FSKProfile& profile) {
+    // Check if pins were configured via constructor
+    if (_csPin < 0 || _rstPin < 0 || _dio0Pin < 0) {
+        return SX1276_ERR_CHIP_NOT_FOUND;  // Pins not configured
     }
-    writeRegister(SX1276_REG_OP_MODE, opMode);
     
-    // Set to standby mode
-    state = standby();
+    uint32_t start = SX1276Hal::micros();
+    
+    // Reset and detect the module
+    int16_t state = startup();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Set frequency (cast to long to avoid ambiguity with float overload)
-    state = setFrequency((long)_freq);
+    state = applyProfile(profile);
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Set bitrate
-    state = setBitrate(_bitrate);
-    if (state != SX1276_ERR_NONE) {
-        return state;
+    _startupTime = SX1276Hal::micros() - start;
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Initialize in FSK/OOK mode from a configuration profile in program memory
+ */
+int16_t SX1276::begin_P(const SX1276FSKProfile* profile) {
+    SX1276FSKProfile copy;
+    SX1276Hal::readProgmem(&copy, profile, sizeof(copy));
+    return begin(copy);
+}
+
+/**
+ * Apply an FSK/OOK configuration profile
+ */
+int16_t SX1276::applyProfile(const SX1276FSKProfile& profile) {
+    SX1276_STATS_SCOPE(SX1276_STATS_CONFIG_FSK);
+
+    // Same limits as setBitrate(), setFrequencyDeviation(), setFrequency() and setSyncWord()
+    if (profile.bitrate < 1200 || profile.bitrate > 300000) {
+        return SX1276_ERR_INVALID_BITRATE;
+    }
+    if (profile.freqDev != 0 && (profile.freqDev < 600 || profile.freqDev > 200000)) {
+        return SX1276_ERR_INVALID_FREQUENCY_DEVIATION;
+    }
+    if (profile.freq < 137000000UL || profile.freq > 1020000000UL) {
+        return SX1276_ERR_INVALID_FREQUENCY;
+    }
+    if (profile.syncWordLen < 1 || profile.syncWordLen > 8) {
+        return SX1276_ERR_INVALID_SYNC_WORD;
     }
     
-    // Set frequency deviation (FSK only)
-    if (_modulation == SX1276_MODULATION_FSK) {
-        state = setFrequencyDeviation(_freqDev);
-        if (state != SX1276_ERR_NONE) {
-            return state;
-        }
-    }
+    // Follow RadioLib's approach for robust mode switching:
+    // 1. Go to sleep (preserving current modulation)
+    // 2. Change modulation bit
+    // 3. Continue with configuration in the new mode
     
-    // Set RX bandwidth
-    state = setRxBandwidth(_rxBw);
+    // Step 1: Go to sleep in current modulation
+    // Our setMode() preserves modulation bits when not explicitly specified
+    int16_t state = setMode(SX1276_MODE_SLEEP);
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
-    // Set AFC bandwidth (same as RX bandwidth)
-    writeRegister(SX1276_REG_AFC_BW, _rxBw);
+    // Step 2: Clear the LoRa bit (takes effect immediately in sleep mode)
+    // and set the modulation type (FSK or OOK)
+    uint8_t opMode = readShadow(SX1276_REG_OP_MODE) & ~(SX1276_LORA_MODE | 0x60);
+    if (profile.modulation == SX1276_MODULATION_OOK) {
+        opMode |= 0x20;  // Set OOK bit
+    }
+    writeRegister(SX1276_REG_OP_MODE, opMode);
+    
+    SX1276_DEBUG_PRINT(F("After setting FSK mode, OP_MODE=0x"));
+    SX1276_DEBUG_PRINTLN(readRegister(SX1276_REG_OP_MODE), HEX);
     
-    // Set output power
-    state = setPower(_power, _useBoost);
+    // Set to standby mode
+    state = standby();
     if (state != SX1276_ERR_NONE) {
         return state;
     }
     
+    // BITRATE_MSB/LSB, FDEV_MSB/LSB, FRF_MSB/MID/LSB and PA_CONFIG are
+    // consecutive registers (0x02-0x09) - write them in one burst
+    // (frequency deviation is ignored by the chip in OOK mode)
+    writeRegisterBurst(SX1276_REG_BITRATE_MSB, profile.rf, sizeof(profile.rf));
+    writeRegister(SX1276_REG_PA_DAC, profile.paDac);
+
+    // Set RX bandwidth and AFC bandwidth (same as RX bandwidth)
+    const uint8_t rxBw[2] = { profile.rxBw, profile.rxBw };
+    writeRegisterBurst(SX1276_REG_RX_BW, rxBw, sizeof(rxBw));
+
     // Set OCP to 120mA (safer for FSK/OOK)
     writeRegister(SX1276_REG_OCP, 0x20 | 0x0F);
     
-    // Set RSSI threshold to -127.5 dBm (0xFF) - essentially no threshold
-    // This allows reception of weak signals
-    writeRegister(SX1276_REG_RSSI_THRESH, 0xFF);
-    
-    // Configure RSSI measurement (needed for valid RSSI readings)
-    // Bits 7-3: RSSI offset (0 = no offset)
-    // Bits 2-0: RSSI smoothing (2 = 8 samples, default)
-    writeRegister(SX1276_REG_RSSI_CONFIG, 0x02);  // 8 samples smoothing, 0 offset
-    
-    // Configure RX_CONFIG: AGC auto on, AFC/AGC trigger on RSSI interrupt
-    // Bit 7: RestartRxOnCollision = 0 (off)
-    // Bit 6: RestartRxWithoutPLLLock = 0
-    // Bit 5: RestartRxWithPLLLock = 0
-    // Bit 4: AfcAutoOn = 0 (off initially, can be enabled if needed)
-    // Bit 3: AgcAutoOn = 1 (AGC auto on)
-    // Bits 2-0: AfcAgcTrigger = 001 (RSSI interrupt)
-    writeRegister(SX1276_REG_RX_CONFIG, 0x08 | 0x01);  // AGC auto + RSSI trigger
-    
+    // RX_CONFIG, RSSI_CONFIG, RSSI_COLLISION and RSSI_THRESH (0x0D-0x10)
+    const uint8_t rxConfig[4] = {
+        // Configure RX_CONFIG: AGC auto on, AFC/AGC trigger on RSSI interrupt
+        // Bit 7: RestartRxOnCollision = 0 (off)
+        // Bit 6: RestartRxWithoutPLLLock = 0
+        // Bit 5: RestartRxWithPLLLock = 0
+        // Bit 4: AfcAutoOn = 0 (off initially, can be enabled if needed)
+        // Bit 3: AgcAutoOn = 1 (AGC auto on)
+        // Bits 2-0: AfcAgcTrigger = 001 (RSSI interrupt)
+        0x08 | 0x01,
+
+        // Configure RSSI measurement (needed for valid RSSI readings)
+        // Bits 7-3: RSSI offset (0 = no offset)
+        // Bits 2-0: RSSI smoothing (2 = 8 samples, default)
+        0x02,
+
+        // RSSI collision threshold: 10 dB (reset default)
+        0x0A,
+
+        // Set RSSI threshold to -127.5 dBm (0xFF) - essentially no threshold
+        // This allows reception of weak signals
+        0xFF
+    };
+    writeRegisterBurst(SX1276_REG_RX_CONFIG, rxConfig, sizeof(rxConfig));
+
     // Reset FIFO overrun flag
     writeRegister(SX1276_REG_IRQ_FLAGS_2, SX1276_IRQ2_FIFO_OVERRUN);
-    
+
+    // PREAMBLE_DETECT and RX_TIMEOUT_1..3 (0x1F-0x22)
+    // Set preamble detector (3 bytes minimum)
     // Disable Rx timeouts to prevent premature timeout errors
     // These must be disabled for reliable packet reception
-    writeRegister(SX1276_REG_RX_TIMEOUT_1, 0x00);  // Disable RSSI timeout
-    writeRegister(SX1276_REG_RX_TIMEOUT_2, 0x00);  // Disable preamble timeout
-    writeRegister(SX1276_REG_RX_TIMEOUT_3, 0x00);  // Disable sync timeout
-    
-    // Set preamble detector (3 bytes minimum)
-    writeRegister(SX1276_REG_PREAMBLE_DETECT, 0xAA);
-    
-    // Set preamble length
-    state = setPreambleLength(_preambleLengthFSK);
-    if (state != SX1276_ERR_NONE) {
-        return state;
-    }
-    
-    // Set sync word
-    state = setSyncWord(_syncWordFSK, _syncWordLen);
-    if (state != SX1276_ERR_NONE) {
-        return state;
-    }
-    
-    // Set packet configuration
-    state = setPacketConfig(_fixedLength, _crcOnFSK);
-    if (state != SX1276_ERR_NONE) {
-        return state;
-    }
-    
-    // Set payload length (max for variable length mode)
-    writeRegister(SX1276_REG_PAYLOAD_LENGTH_FSK, SX1276_MAX_PACKET_LENGTH);
-    
-    // Set FIFO threshold (half FIFO)
-    writeRegister(SX1276_REG_FIFO_THRESH, 0x80 | 0x20);
-    
-    // Configure sequencer for proper packet reception
-    // SEQ_CONFIG_1: Enable sequencer (don't stop it)
-    writeRegister(SX1276_REG_SEQ_CONFIG_1, 0x00);
-    
-    // SEQ_CONFIG_2: Configure sequencer behavior
-    // Bits 7-5: FromReceive = 001 (packet received on PayloadReady, default)
-    // Bits 4-3: FromRxTimeout = 000 (receive, default)  
-    // Bits 2-0: FromPacketReceived = 100 (go back to receive mode after packet)
-    // Value: 0x24 allows continuous packet reception without manual restart
-    writeRegister(SX1276_REG_SEQ_CONFIG_2, 0x24);
-    
+    const uint8_t rxTimeouts[4] = {
+        0xAA,   // Preamble detector on, 3 bytes
+        0x00,   // Disable RSSI timeout
+        0x00,   // Disable preamble timeout
+        0x00    // Disable sync timeout
+    };
+    writeRegisterBurst(SX1276_REG_PREAMBLE_DETECT, rxTimeouts, sizeof(rxTimeouts));
+
+    // Preamble length, sync word configuration and sync word (0x25-0x2F)
+    writeRegisterBurst(SX1276_REG_PREAMBLE_MSB_FSK, profile.sync, 3 + profile.syncWordLen);
+
+    // PACKET_CONFIG_1, PACKET_CONFIG_2 and PAYLOAD_LENGTH (0x30-0x32)
+    uint8_t packetConfig[3];
+    packetConfig[0] = profile.packetConfig1;  // see setPacketConfig()
+    payloadLengthRegs((profile.packetConfig1 & 0x80) != 0, &packetConfig[1]);
+    writeRegisterBurst(SX1276_REG_PACKET_CONFIG_1, packetConfig, sizeof(packetConfig));
+
+    // FIFO_THRESH, SEQ_CONFIG_1 and SEQ_CONFIG_2 (0x35-0x37)
+    const uint8_t fifoSeqConfig[3] = {
+        // TxStartCondition = FifoEmpty inverted (start with the first byte),
+        // FifoLevel threshold at half the FIFO (see refillFifo()/drainFifo())
+        0x80 | SX1276_FIFO_THRESHOLD_FSK,
+
+        // Configure sequencer for proper packet reception
+        // SEQ_CONFIG_1: Enable sequencer (don't stop it)
+        0x00,
+
+        // SEQ_CONFIG_2: Configure sequencer behavior
+        // Bits 7-5: FromReceive = 001 (packet received on PayloadReady, default)
+        // Bits 4-3: FromRxTimeout = 000 (receive, default)
+        // Bits 2-0: FromPacketReceived = 100 (go back to receive mode after packet)
+        // Value: 0x24 allows continuous packet reception without manual restart
+        0x24
+    };
+    writeRegisterBurst(SX1276_REG_FIFO_THRESH, fifoSeqConfig, sizeof(fifoSeqConfig));
+
     // Set DIO0 to PacketSent/PayloadReady
     writeRegister(SX1276_REG_DIO_MAPPING_1, 0x00);
     
-    return state;
+    // Keep the settings in sync for the setters
+    _modulation = profile.modulation;
+    _freq = profile.freq;
+    _power = profile.power;
+    _useBoost = profile.useBoost;
+    _bitrate = profile.bitrate;
+    _freqDev = profile.freqDev;
+    _rxBw = profile.rxBw;
+    _preambleLengthFSK = ((uint16_t)profile.sync[0] << 8) | profile.sync[1];
+    _syncWordLen = profile.syncWordLen;
+    for (uint8_t i = 0; i < profile.syncWordLen; i++) {
+        _syncWordFSK[i] = profile.sync[3 + i];
+    }
+    _fixedLength = (profile.packetConfig1 & 0x80) != 0;
+    _crcOnFSK = (profile.packetConfig1 & 0x10) != 0;
+    
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * Apply an FSK/OOK configuration profile in program memory
+ */
+int16_t SX1276::applyProfile_P(const SX1276FSKProfile* profile) {
+    SX1276FSKProfile copy;
+    SX1276Hal::readProgmem(&copy, profile, sizeof(copy));
+    return applyProfile(copy);
 }
 
 /**
@@ -1282,7 +2532,7 @@ int16_t SX1276::setBitrate(uint32_t bitrate) {
     
     // Calculate bitrate register value
     // Bitrate = FXOSC / BitrateReg
-    uint32_t bitrateReg = SX1276_FXOSC / bitrate;
+    uint32_t bitrateReg = SX1276Reg::bitrate(bitrate);
     
     writeRegister(SX1276_REG_BITRATE_MSB, (bitrateReg >> 8) & 0xFF);
     writeRegister(SX1276_REG_BITRATE_LSB, bitrateReg & 0xFF);
@@ -1303,7 +2553,7 @@ int16_t SX1276::setFrequencyDeviation(uint32_t freqDev) {
     
     // Calculate frequency deviation register value
     // Fdev = FSTEP × FreqDevReg
-    uint32_t fdevReg = ((uint64_t)freqDev << 19) / SX1276_FXOSC;
+    uint32_t fdevReg = SX1276Reg::fdev(freqDev);
     
     writeRegister(SX1276_REG_FDEV_MSB, (fdevReg >> 8) & 0x3F);
     writeRegister(SX1276_REG_FDEV_LSB, fdevReg & 0xFF);
@@ -1338,13 +2588,14 @@ int16_t SX1276::setSyncWord(const uint8_t* syncWord, uint8_t len) {
     // Bit 7: Sync On
     // Bits 5-3: FIFO fill condition
     // Bits 2-0: Sync word size - 1
-    writeRegister(SX1276_REG_SYNC_CONFIG, 0x90 | ((len - 1) & 0x07));
-    
-    // Write sync word bytes
+    // SYNC_CONFIG is followed by SYNC_VALUE_1..8 - write all in one burst
+    uint8_t syncConfig[9];
+    syncConfig[0] = 0x90 | ((len - 1) & 0x07);
     for (uint8_t i = 0; i < len; i++) {
-        writeRegister(SX1276_REG_SYNC_VALUE_1 + i, syncWord[i]);
+        syncConfig[1 + i] = syncWord[i];
     }
-    
+    writeRegisterBurst(SX1276_REG_SYNC_CONFIG, syncConfig, 1 + len);
+
     return SX1276_ERR_NONE;
 }
 
@@ -1361,25 +2612,152 @@ int16_t SX1276::setPacketConfig(bool fixedLength, bool crcOn) {
     // Bit 4: CRC on (1) or off (0)
     // Bit 3: CRC auto clear off
     // Bit 2-0: Address filtering (000 = off)
-    uint8_t config1 = 0x00;
+    uint8_t packetConfig[3];
+    packetConfig[0] = 0x00;
     if (fixedLength) {
-        config1 |= 0x80;
+        packetConfig[0] |= 0x80;
     }
     if (crcOn) {
-        config1 |= 0x10;
+        packetConfig[0] |= 0x10;
+    }
+    
+    // PacketConfig2 and PayloadLength (see payloadLengthRegs())
+    payloadLengthRegs(fixedLength, &packetConfig[1]);
+    writeRegisterBurst(SX1276_REG_PACKET_CONFIG_1, packetConfig, sizeof(packetConfig));
+    
+    return SX1276_ERR_NONE;
+}
+
+/**
+ * FSK/OOK receiver wake-up time in us for the current RX bandwidth
+ * Datasheet TS_RE_AGC&AFC is about 40 / RxBw (4 ms at 10.4 kHz, 15 ms at 2.6 kHz).
+ * RxBw = FXOSC / (RxBwMant x 2^(RxBwExp + 2)), so 40 / RxBw = 5 us x RxBwMant x 2^RxBwExp.
+ */
+uint32_t SX1276::rxWakeupTimeUs() {
+    uint32_t mant = 16 + 4 * ((_rxBw >> 3) & 0x03);
+    return (5 * mant) << (_rxBw & 0x07);
+}
+
+/**
+ * Set the FSK/OOK payload length
+ */
+int16_t SX1276::setPayloadLength(uint16_t len) {
+    if (len > (_fixedLength ? SX1276_MAX_PACKET_LENGTH_FSK : SX1276_MAX_PACKET_LENGTH)) {
+        return SX1276_ERR_PACKET_TOO_LONG;
     }
-    writeRegister(SX1276_REG_PACKET_CONFIG_1, config1);
     
-    // PacketConfig2
-    // Bit 6: Data mode (1 = packet)
-    // Bits 5-3: I/O home control
-    // Bit 2: Beacon on (0)
-    // Bits 1-0: Payload length MSB
-    writeRegister(SX1276_REG_PACKET_CONFIG_2, 0x40);
+    _payloadLengthFSK = len;
     
+    // PACKET_CONFIG_2 and PAYLOAD_LENGTH (0x31-0x32)
+    uint8_t length[2];
+    payloadLengthRegs(_fixedLength, length);
+    writeRegisterBurst(SX1276_REG_PACKET_CONFIG_2, length, sizeof(length));
     return SX1276_ERR_NONE;
 }
 
+/**
+ * PACKET_CONFIG_2 and PAYLOAD_LENGTH values for the stored payload length
+ * Bit 6: Data mode (1 = packet), bits 5-4: I/O home control (off), bit 3: beacon
+ * off, bits 2-0: PayloadLength bits 10-8 (fixed length mode only, variable
+ * length mode accepts at most SX1276_MAX_PACKET_LENGTH)
+ */
+void SX1276::payloadLengthRegs(bool fixedLength, uint8_t* regs) {
+    uint16_t len = _payloadLengthFSK;
+    if (!fixedLength && len > SX1276_MAX_PACKET_LENGTH) {
+        len = SX1276_MAX_PACKET_LENGTH;
+    }
+    regs[0] = 0x40 | ((len >> 8) & 0x07);
+    regs[1] = len & 0xFF;
+}
+
+/**
+ * FifoLevel: 1 if the FIFO holds more than SX1276_FIFO_THRESHOLD_FSK bytes, 0 if not
+ * Without DIO1, IRQ_FLAGS_2 is read at most every SX1276_FIFO_POLL_BYTES byte
+ * times; -1 in between (not checked).
+ */
+int8_t SX1276::fifoLevel() {
+    if (_dio1Pin >= 0) {
+        return (SX1276Hal::digitalRead(_dio1Pin) == HIGH) ? 1 : 0;
+    }
+    uint32_t now = SX1276Hal::micros();
+    if (now - _fifoPollTime < _fifoPollUs) {
+        return -1;
+    }
+    _fifoPollTime = now;
+    return (readRegister(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_FIFO_LEVEL) ? 1 : 0;
+}
+
+/**
+ * Transmit streaming: top up the FIFO once it has drained to the threshold
+ */
+void SX1276::refillFifo() {
+    if (_txRemaining == 0 || _modulation == SX1276_MODULATION_LORA) {
+        return;
+    }
+    if (fifoLevel() != 0) {
+        return;
+    }
+    
+    // At most SX1276_FIFO_THRESHOLD_FSK bytes are left, so the other half is free
+    uint16_t count = SX1276_FIFO_SIZE_FSK - SX1276_FIFO_THRESHOLD_FSK;
+    if (count > _txRemaining) {
+        count = _txRemaining;
+    }
+    writeRegisterBurst(SX1276_REG_FIFO, _txData, count);
+    _txData += count;
+    _txRemaining -= count;
+}
+
+/**
+ * Receive streaming: take a block from the FIFO once it is filled above the threshold
+ */
+void SX1276::drainFifo() {
+    if (!_rxStreaming || _modulation == SX1276_MODULATION_LORA) {
+        return;
+    }
+    if (fifoLevel() != 1) {
+        return;
+    }
+    
+    // More than SX1276_FIFO_THRESHOLD_FSK bytes are waiting
+    readFifoPayload(SX1276_FIFO_THRESHOLD_FSK);
+}
+
+/**
+ * Read up to count bytes of the current packet from the FIFO into _rxData
+ * Starts with the length byte in variable length mode; bytes beyond
+ * _rxMaxLen are read and discarded.
+ */
+void SX1276::readFifoPayload(uint16_t count) {
+    spiBegin();
+    spiTransfer(SX1276_REG_FIFO);
+    
+    // Variable length mode - first byte in FIFO is length
+    if (_rxLen == SX1276_LENGTH_UNKNOWN && count > 0) {
+        _rxLen = spiTransfer(0x00);
+        count--;
+    }
+    if (count > _rxLen - _rxRead) {
+        count = _rxLen - _rxRead;
+    }
+    
+    // Payload data fitting the buffer
+    uint16_t stored = 0;
+    if (_rxRead < _rxMaxLen) {
+        stored = _rxMaxLen - _rxRead;
+        if (stored > count) {
+            stored = count;
+        }
+        spiReadBuffer(_rxData + _rxRead, stored);
+    }
+    for (uint16_t i = stored; i < count; i++) {
+        spiTransfer(0x00);
+    }
+    spiEnd();
+    
+    _rxRead += count;
+}
+
 /**
  * Get RSSI in FSK/OOK mode
  * Returns the cached RSSI value from the last received packet
@@ -1387,6 +2765,26 @@ int16_t SX1276::setPacketConfig(bool fixedLength, bool crcOn) {
 int16_t SX1276::getRSSI_FSK() {
     return _lastRSSI;
 }
+
+/**
+ * Get bit rate from the BITRATE registers
+ * BitRate = FXOSC / BitrateReg (fractional part ignored)
+ */
+uint32_t SX1276::getBitrate() {
+    uint8_t regs[2];
+    readRegisterBurst(SX1276_REG_BITRATE_MSB, regs, sizeof(regs));
+    return SX1276Reg::bitrateToBps(((uint16_t)regs[0] << 8) | regs[1]);
+}
+
+/**
+ * Get frequency deviation from the FDEV registers
+ * Fdev = FSTEP × FreqDevReg
+ */
+uint32_t SX1276::getFrequencyDeviation() {
+    uint8_t regs[2];
+    readRegisterBurst(SX1276_REG_FDEV_MSB, regs, sizeof(regs));
+    return SX1276Reg::fdevToFrequency(((uint16_t)(regs[0] & 0x3F) << 8) | regs[1]);
+}
 #endif
 
 /**
@@ -1408,27 +2806,315 @@ void SX1276::writeRegister(uint8_t addr, uint8_t value) {
     spiTransfer(addr | 0x80);  // Write: MSB = 1
     spiTransfer(value);
     spiEnd();
+
+    updateShadow(addr, value);
+}
+
+/**
+ * Read a register value for read-modify-write access
+ * Returns the shadow copy if the register is cached, otherwise reads it via SPI
+ */
+uint8_t SX1276::readShadow(uint8_t addr) {
+#ifdef SX1276_SHADOW_REGISTERS
+    switch (addr) {
+        case SX1276_REG_OP_MODE:
+            return _shadowOpMode;
+        case SX1276_REG_LNA:
+            return _shadowLna;
+#ifdef LORA_ENABLED
+        case SX1276_REG_MODEM_CONFIG_1:
+            return _shadowModemConfig1;
+        case SX1276_REG_MODEM_CONFIG_2:
+            return _shadowModemConfig2;
+#endif
+        default:
+            break;
+    }
+#endif
+    return readRegister(addr);
+}
+
+/**
+ * Track a register write in the shadow cache
+ */
+void SX1276::updateShadow(uint8_t addr, uint8_t value) {
+    // Operating mode is tracked with or without the shadow cache
+    if (addr == SX1276_REG_OP_MODE) {
+        _mode = value;
+    }
+
+#ifdef SX1276_SHADOW_REGISTERS
+    switch (addr) {
+        case SX1276_REG_OP_MODE:
+            _shadowOpMode = value;
+            break;
+        case SX1276_REG_LNA:
+            _shadowLna = value;
+            break;
+#ifdef LORA_ENABLED
+        // 0x1D/0x1E are FEI_MSB/LSB in FSK/OOK mode - only track them in LoRa mode
+        case SX1276_REG_MODEM_CONFIG_1:
+            if (_shadowOpMode & SX1276_LORA_MODE) {
+                _shadowModemConfig1 = value;
+            }
+            break;
+        case SX1276_REG_MODEM_CONFIG_2:
+            if (_shadowOpMode & SX1276_LORA_MODE) {
+                _shadowModemConfig2 = value;
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+#else
+    (void)addr;
+    (void)value;
+#endif
+}
+
+/**
+ * Set the shadow cache to the register reset values (datasheet)
+ */
+void SX1276::resetShadow() {
+#ifdef SX1276_SHADOW_REGISTERS
+    _shadowOpMode = 0x09;  // FSK/OOK, LowFrequencyModeOn, standby
+    _shadowLna = 0x20;
+#ifdef LORA_ENABLED
+    _shadowModemConfig1 = 0x72;
+    _shadowModemConfig2 = 0x70;
+#endif
+#endif
+}
+
+/**
+ * Reload the shadow cache from the chip
+ */
+void SX1276::resyncShadow() {
+#ifdef SX1276_SHADOW_REGISTERS
+    _shadowOpMode = readRegister(SX1276_REG_OP_MODE);
+    _shadowLna = readRegister(SX1276_REG_LNA);
+#ifdef LORA_ENABLED
+    if (_shadowOpMode & SX1276_LORA_MODE) {
+        uint8_t modemConfig[2];
+        readRegisterBurst(SX1276_REG_MODEM_CONFIG_1, modemConfig, sizeof(modemConfig));
+        _shadowModemConfig1 = modemConfig[0];
+        _shadowModemConfig2 = modemConfig[1];
+    }
+#endif
+#endif
+}
+
+/**
+ * Read consecutive registers in one transaction
+ */
+void SX1276::readRegisterBurst(uint8_t addr, uint8_t* buf, size_t len) {
+    spiBegin();
+    spiTransfer(addr & 0x7F);  // Read: MSB = 0, address auto-increments
+    spiReadBuffer(buf, len);
+    spiEnd();
+}
+
+/**
+ * Write consecutive registers in one transaction
+ */
+void SX1276::writeRegisterBurst(uint8_t addr, const uint8_t* buf, size_t len) {
+    spiBegin();
+    spiTransfer(addr | 0x80);  // Write: MSB = 1, address auto-increments
+    spiWriteBuffer(buf, len);
+    spiEnd();
+
+    // The FIFO address does not increment - nothing to track there
+#ifdef SX1276_SHADOW_REGISTERS
+    if (addr != SX1276_REG_FIFO) {
+        for (size_t i = 0; i < len; i++) {
+            updateShadow(addr + i, buf[i]);
+        }
+    }
+#endif
 }
 
 /**
  * Begin SPI transaction
  */
 void SX1276::spiBegin() {
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-    digitalWrite(_csPin, LOW);
+    SX1276Hal::spiBeginTransaction(_spiSettings);
+    SX1276Hal::fastPinLow(_csFast);
+#ifdef SX1276_STATS
+    _statsBusStart = SX1276Hal::micros();
+    statsCount(1, 0, 0);
+#endif
 }
 
 /**
  * End SPI transaction
  */
 void SX1276::spiEnd() {
-    digitalWrite(_csPin, HIGH);
-    SPI.endTransaction();
+    SX1276Hal::fastPinHigh(_csFast);
+    SX1276Hal::spiEndTransaction();
+#ifdef SX1276_STATS
+    statsCount(0, 0, SX1276Hal::micros() - _statsBusStart);
+#endif
 }
 
 /**
  * Transfer a byte via SPI
  */
 uint8_t SX1276::spiTransfer(uint8_t data) {
-    return SPI.transfer(data);
+#ifdef SX1276_STATS
+    statsCount(0, 1, 0);
+#endif
+    return SX1276Hal::spiTransfer(data);
+}
+
+/**
+ * Write a buffer via SPI (within a transaction)
+ */
+void SX1276::spiWriteBuffer(const uint8_t* data, size_t len) {
+#ifdef SX1276_STATS
+    statsCount(0, len, 0);
+#endif
+    SX1276Hal::spiWrite(data, len);
+}
+
+/**
+ * Read into a buffer via SPI (within a transaction)
+ */
+void SX1276::spiReadBuffer(uint8_t* data, size_t len) {
+#ifdef SX1276_STATS
+    statsCount(0, len, 0);
+#endif
+    SX1276Hal::spiRead(data, len);
+}
+
+#ifdef SX1276_ASYNC_FIFO
+/**
+ * Start writing data to the FIFO in the background
+ */
+int16_t SX1276::startFifoWrite(const uint8_t* data, size_t len) {
+    return startFifoTransfer(SX1276_REG_FIFO | 0x80, data, nullptr, len);
+}
+
+/**
+ * Start reading data from the FIFO in the background
+ */
+int16_t SX1276::startFifoRead(uint8_t* data, size_t len) {
+    return startFifoTransfer(SX1276_REG_FIFO, nullptr, data, len);
+}
+
+/**
+ * Check whether the background FIFO transfer has completed
+ */
+bool SX1276::isFifoTransferDone() {
+    if (_fifoBusy) {
+        if (!SX1276Hal::spiAsyncDone()) {
+            return false;
+        }
+        
+        // Release chip select and the SPI bus
+        spiEnd();
+        _fifoBusy = false;
+    }
+    
+    // Packet of readDataAsync() truncated - writing FifoOverrun clears the FIFO
+    if (_rxTruncated) {
+        _rxTruncated = false;
+        writeRegister(SX1276_REG_IRQ_FLAGS_2, SX1276_IRQ2_FIFO_OVERRUN);
+    }
+    
+    // Payload of startTransmitAsync() loaded - start the transmission
+    if (_txPending) {
+        _txPending = false;
+        _txError = enterTransmit();
+    }
+    return true;
+}
+
+/**
+ * Open the FIFO transaction and hand the payload to the backend
+ */
+int16_t SX1276::startFifoTransfer(uint8_t addr, const uint8_t* tx, uint8_t* rx, size_t len) {
+    if (_fifoBusy) {
+        return SX1276_ERR_BUSY;
+    }
+
+    spiBegin();
+    spiTransfer(addr);
+
+    if (len > 0 && SX1276Hal::spiStartAsync(tx, rx, len)) {
+#ifdef SX1276_STATS
+        statsCount(0, len, 0);
+#endif
+        // Transaction is closed by isFifoTransferDone()
+        _fifoBusy = true;
+        return SX1276_ERR_NONE;
+    }
+
+    // No background transfer available - fall back to blocking block transfer
+    if (tx != nullptr) {
+        spiWriteBuffer(tx, len);
+    } else {
+        spiReadBuffer(rx, len);
+    }
+    spiEnd();
+    return SX1276_ERR_NONE;
+}
+#endif
+
+#ifdef SX1276_STATS
+/**
+ * Get SPI instrumentation counters
+ */
+const SX1276Stats& SX1276::getStats() const {
+    return _stats;
+}
+
+/**
+ * Reset SPI instrumentation counters
+ */
+void SX1276::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+/**
+ * Add to the counters of all operations in progress
+ */
+void SX1276::statsCount(uint32_t transactions, uint32_t bytes, uint32_t busMicros) {
+    for (uint8_t i = 0; i < SX1276_STATS_COUNT; i++) {
+        if (_statsActive & (1 << i)) {
+            _stats.op[i].transactions += transactions;
+            _stats.op[i].bytes += bytes;
+            _stats.op[i].busMicros += busMicros;
+        }
+    }
+}
+
+/**
+ * Start counting an operation
+ * A nested call of the same operation is counted as part of the outer call.
+ */
+SX1276::StatsScope::StatsScope(SX1276* radio, uint8_t op) {
+    _radio = radio;
+    _op = op;
+    _mask = 1 << op;
+    _start = 0;
+    if (_radio->_statsActive & _mask) {
+        _mask = 0;
+        return;
+    }
+    _radio->_statsActive |= _mask;
+    _radio->_stats.op[op].calls++;
+    _start = SX1276Hal::micros();
+}
+
+/**
+ * Stop counting the operation
+ */
+SX1276::StatsScope::~StatsScope() {
+    if (_mask == 0) {
+        return;
+    }
+    _radio->_statsActive &= ~_mask;
+    _radio->_stats.op[_op].micros += SX1276Hal::micros() - _start;
 }
+#endif
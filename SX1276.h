@@ -11,8 +11,7 @@
 #ifndef SX1276_H
 #define SX1276_H
 
-#include <Arduino.h>
-#include <SPI.h>
+#include "SX1276Hal.h"
 
 // Optional LoRa support - define this to enable LoRa modulation
 #define LORA_ENABLED
@@ -20,6 +19,32 @@
 // Optional FSK/OOK support - define this to enable FSK/OOK modulation  
 #define FSK_OOK_ENABLED
 
+// Shadow register cache - define to keep a copy of OP_MODE, LNA and
+// MODEM_CONFIG_1/2 in the driver, so read-modify-write accesses and mode
+// changes only need an SPI write (4 bytes of RAM)
+#define SX1276_SHADOW_REGISTERS
+
+// Floating point RadioLib API - define to provide begin()/beginFSK()/setFrequency()
+// with MHz/kHz float arguments as inline wrappers around the integer functions
+// (beginLoRaHz(), beginFSKHz(), setFrequency(long)); with constant arguments the
+// compiler folds the conversion, so no soft-float code is linked
+#define SX1276_FLOAT_API
+
+// Asynchronous FIFO transfers - define to enable startTransmitAsync()/readDataAsync()
+// and startFifoWrite()/startFifoRead()
+// (DMA on RP2040 with arduino-pico, blocking block transfer on other cores)
+// #define SX1276_ASYNC_FIFO
+
+// SPI instrumentation - define to count SPI transactions, bytes and time per
+// driver operation (see getStats(); compiled out completely if not defined)
+// #define SX1276_STATS
+
+// Receive queue - define to enable available()/readPacket(): after startReceive()
+// the radio stays in RX and each packet is copied into a ring buffer of
+// SX1276_RX_QUEUE_SIZE packets (RAM: SX1276_RX_QUEUE_SIZE x
+// (SX1276_RX_QUEUE_PACKET_LENGTH + 8) bytes)
+// #define SX1276_RX_QUEUE
+
 // Debugging support - define to enable debug output
 // #define SX1276_DEBUG
 
@@ -107,11 +132,13 @@
 #define SX1276_REG_PKT_SNR_VALUE                0x19
 #define SX1276_REG_PKT_RSSI_VALUE               0x1A
 #define SX1276_REG_RSSI_VALUE                   0x1B
+#define SX1276_REG_HOP_CHANNEL                  0x1C
 #define SX1276_REG_MODEM_CONFIG_1               0x1D
 #define SX1276_REG_MODEM_CONFIG_2               0x1E
 #define SX1276_REG_PREAMBLE_MSB                 0x20
 #define SX1276_REG_PREAMBLE_LSB                 0x21
 #define SX1276_REG_PAYLOAD_LENGTH               0x22
+#define SX1276_REG_HOP_PERIOD                   0x24
 #define SX1276_REG_MODEM_CONFIG_3               0x26
 #define SX1276_REG_FREQ_ERROR_MSB               0x28
 #define SX1276_REG_FREQ_ERROR_MID               0x29
@@ -138,6 +165,7 @@
 #define SX1276_MODE_RX_CONTINUOUS               0x05
 #define SX1276_MODE_RX_SINGLE                   0x06
 #define SX1276_MODE_CAD                         0x07
+#define SX1276_MODE_UNKNOWN                     0xFF  // Not known to the driver (see getMode())
 
 // Modulation Type
 #define SX1276_LORA_MODE                        0x80
@@ -249,12 +277,317 @@
 #define SX1276_ERR_INVALID_FREQUENCY_DEVIATION  -12
 #define SX1276_ERR_INVALID_SYNC_WORD            -13
 #define SX1276_ERR_WRONG_MODEM                  -14
+#define SX1276_ERR_BUSY                         -15
+#define SX1276_ERR_MODE_TIMEOUT                 -16
+#define SX1276_ERR_NO_PACKET                    -17
 
 // Constants
 #define SX1276_MAX_PACKET_LENGTH                255
+#define SX1276_MAX_PACKET_LENGTH_FSK            2047  // FSK/OOK fixed length mode (11-bit PayloadLength)
 #define SX1276_FIFO_SIZE                        256
+#define SX1276_FIFO_SIZE_FSK                    64
+#define SX1276_FIFO_THRESHOLD_FSK               32    // FifoLevel is set above this many bytes
+#define SX1276_FIFO_POLL_BYTES                  16    // FifoLevel polling interval without DIO1, in byte times
 #define SX1276_FXOSC                            32000000L  // 32 MHz crystal
 #define SX1276_FSTEP                            (SX1276_FXOSC / 524288.0)  // FXOSC / 2^19
+#define SX1276_SPI_MAX_FREQUENCY                10000000L  // SX1276 maximum SCK frequency
+
+// Mode transition times (datasheet, used in LoRa mode which has no ModeReady flag)
+#define SX1276_TS_OSC_US                        250   // SLEEP -> STDBY (crystal oscillator startup)
+#define SX1276_TS_FS_US                         60    // STDBY -> FS (PLL lock)
+#define SX1276_TS_TR_US                         60    // FS -> TX/RX (PA ramp-up / receiver startup)
+
+// Reset timing (datasheet: > 100 us pulse, chip ready within 5 ms)
+#define SX1276_RESET_PULSE_US                   100
+#define SX1276_RESET_POLL_US                    100   // Version register polling interval
+#define SX1276_RESET_TIMEOUT_US                 10000
+
+// Upper bound for the ModeReady flag in FSK/OOK mode (oscillator startup and
+// PLL lock; RX adds twice the receiver wake-up time, see rxWakeupTimeUs())
+#define SX1276_MODE_READY_TIMEOUT_US            2000
+
+// Temperature sensor and image calibration (RegImageCal)
+#define SX1276_IMAGE_CAL_START                  0x40
+#define SX1276_IMAGE_CAL_RUNNING                0x20
+#define SX1276_TEMP_MONITOR_OFF                 0x01
+#define SX1276_TEMP_MEASURE_US                  150   // Sensor conversion time in FSRX
+#define SX1276_IMAGE_CAL_TIMEOUT_US             20000 // Upper bound for ImageCalRunning (typ. 10 ms)
+#define SX1276_CAL_TEMP_THRESHOLD               10    // Default drift (degrees C) for calibrateImage()
+
+// Default SPI clock frequency (can be changed at runtime with setSpiFrequency())
+#ifndef SX1276_SPI_FREQUENCY
+#define SX1276_SPI_FREQUENCY                    2000000L
+#endif
+
+// Radios which can use the DIO0 interrupt at the same time (1-4); further
+// instances fall back to reading the DIO0 pin
+#ifndef SX1276_MAX_INSTANCES
+#define SX1276_MAX_INSTANCES                    2
+#endif
+
+#ifdef SX1276_RX_QUEUE
+#ifndef SX1276_RX_QUEUE_SIZE
+#define SX1276_RX_QUEUE_SIZE                    4     // Packets
+#endif
+#ifndef SX1276_RX_QUEUE_PACKET_LENGTH
+#define SX1276_RX_QUEUE_PACKET_LENGTH           64    // Bytes stored per packet, longer packets are truncated
+#endif
+#endif
+
+#ifdef SX1276_STATS
+// Operations tracked by the SPI instrumentation (index into SX1276Stats::op)
+#define SX1276_STATS_CONFIG                     0  // config() (LoRa configuration, setModulation())
+#define SX1276_STATS_CONFIG_FSK                 1  // configFSK()
+#define SX1276_STATS_TRANSMIT                   2  // transmit()
+#define SX1276_STATS_RECEIVE                    3  // receive()
+#define SX1276_STATS_SET_MODE                   4  // Mode changes (setMode())
+#define SX1276_STATS_TOTAL                      5  // All SPI accesses
+#define SX1276_STATS_COUNT                      6
+
+/**
+ * SPI instrumentation counters of one operation
+ * Counters are inclusive: SPI accesses of a nested operation (e.g. setMode()
+ * within transmit()) are counted for both operations.
+ */
+struct SX1276OpStats {
+    uint32_t calls;         // Number of calls (not counted for SX1276_STATS_TOTAL)
+    uint32_t transactions;  // SPI transactions (chip select cycles)
+    uint32_t bytes;         // SPI bytes (including address bytes)
+    uint32_t busMicros;     // Time with chip select asserted in us
+    uint32_t micros;        // Time spent in the operation in us (not counted for SX1276_STATS_TOTAL)
+};
+
+/**
+ * SPI instrumentation counters
+ */
+struct SX1276Stats {
+    SX1276OpStats op[SX1276_STATS_COUNT];
+};
+#endif
+
+#ifdef SX1276_RX_QUEUE
+/**
+ * Packet taken from the chip in continuous reception (see SX1276::readPacket())
+ */
+struct SX1276Packet {
+    uint8_t len;            // Bytes in data (truncated to SX1276_RX_QUEUE_PACKET_LENGTH)
+    int8_t snr;             // LoRa: SNR in dB scaled by 4 (as getSNR()), FSK/OOK: 0
+    int16_t rssi;           // RSSI in dBm
+    uint32_t timestamp;     // millis() when the packet was taken from the chip
+    uint8_t data[SX1276_RX_QUEUE_PACKET_LENGTH];
+};
+#endif
+
+class SX1276;
+
+/**
+ * Register value calculations
+ * All functions are constexpr, so with constant arguments the values are
+ * computed by the compiler (see SX1276LoRaProfile and SX1276FSKProfile).
+ */
+struct SX1276Reg {
+    static_assert(SX1276_FXOSC == 32000000L, "Step conversions assume FSTEP = 15625 / 256 Hz");
+
+    // FRF = (Freq × 2^19) / FXOSC
+    static constexpr uint32_t frf(uint32_t freq) {
+        return hzToSteps(freq);
+    }
+
+    // Bitrate = FXOSC / BitrateReg
+    static constexpr uint16_t bitrate(uint32_t bitrate) {
+        return SX1276_FXOSC / bitrate;
+    }
+
+    // Fdev = FSTEP × FreqDevReg
+    static constexpr uint16_t fdev(uint32_t freqDev) {
+        return hzToSteps(freqDev);
+    }
+
+    // Freq = FSTEP × FRF (rounded up, so that frf(frfToFrequency(x)) == x)
+    static constexpr uint32_t frfToFrequency(uint32_t frf) {
+        return (frf >> 8) * 15625UL + (((frf & 0xFF) * 15625UL + 255) >> 8);
+    }
+
+    // Bitrate in bps from BitrateReg
+    static constexpr uint32_t bitrateToBps(uint16_t bitrateReg) {
+        return bitrateReg ? SX1276_FXOSC / bitrateReg : 0;
+    }
+
+    // Fdev in Hz from FreqDevReg
+    static constexpr uint32_t fdevToFrequency(uint16_t fdevReg) {
+        return frfToFrequency(fdevReg);
+    }
+
+    /**
+     * Hz to synthesizer steps: floor(hz × 2^19 / FXOSC) = floor(hz × 256 / 15625)
+     * without 64-bit division (valid up to 1.1 GHz).
+     * 256 / 15625 is approximated by 1073.74185 / 65536 (1073 + 48616 / 65536), which
+     * underestimates by at most one step; stepsAdjust() corrects with the exact remainder.
+     */
+    static constexpr uint32_t hzToSteps(uint32_t hz) {
+        return stepsAdjust(hz, (hz >> 16) * 1073UL + (((hz >> 16) * 48616UL + (hz & 0xFFFF) * 1073UL) >> 16));
+    }
+
+    // Remainder hz × 256 - steps × 15625 (computed mod 2^32) must be below 15625
+    static constexpr uint32_t stepsAdjust(uint32_t hz, uint32_t steps) {
+        return ((uint32_t)((hz << 8) - steps * 15625UL) >= 15625UL) ? steps + 1 : steps;
+    }
+
+    // PA_CONFIG: PA_BOOST pin 2..17 dBm (18..20 dBm with PA_DAC high power), RFO pin -1..14 dBm
+    static constexpr uint8_t paConfig(int8_t power, bool useBoost) {
+        return useBoost
+            ? (power > 17 ? (SX1276_PA_BOOST | ((power > 20 ? 20 : power) - 5))
+                          : (SX1276_PA_BOOST | ((power < 2 ? 2 : power) - 2)))
+            : (SX1276_MAX_POWER | ((power > 14 ? 14 : (power < -1 ? -1 : power)) + 1));
+    }
+
+    // PA_DAC: +20 dBm mode above 17 dBm on PA_BOOST
+    static constexpr uint8_t paDac(int8_t power, bool useBoost) {
+        return (useBoost && power > 17) ? 0x87 : 0x84;
+    }
+};
+
+#ifdef LORA_ENABLED
+/**
+ * LoRa configuration profile
+ * The constructor computes the register image, so a profile declared
+ * constexpr needs no runtime calculation (and no RAM with SX1276_PROGMEM on AVR).
+ * Apply with begin(), applyProfile() or applyProfile_P().
+ *
+ * Example:
+ *   constexpr SX1276LoRaProfile profile(868100000UL, SX1276_BW_125_KHZ, SX1276_SF_9);
+ */
+struct SX1276LoRaProfile {
+    /**
+     * Constructor
+     * @param freq Carrier frequency in Hz
+     * @param bw Bandwidth (SX1276_BW_*)
+     * @param sf Spreading factor (SX1276_SF_*)
+     * @param cr Coding rate (SX1276_CR_*)
+     * @param syncWord Sync word
+     * @param power Output power in dBm
+     * @param preambleLength Preamble length in symbols
+     * @param crc Payload CRC on
+     * @param useBoost Use PA_BOOST pin
+     */
+    explicit constexpr SX1276LoRaProfile(uint32_t freq, uint8_t bw = SX1276_BW_125_KHZ, uint8_t sf = SX1276_SF_7,
+                                uint8_t cr = SX1276_CR_4_5, uint8_t syncWord = 0x12, int8_t power = 17,
+                                uint16_t preambleLength = 8, bool crc = true, bool useBoost = true)
+        : SX1276LoRaProfile(SX1276Reg::frf(freq), freq, bw, sf, cr, syncWord, power, preambleLength, crc, useBoost) {}
+
+    uint32_t freq;              // Carrier frequency in Hz
+    int8_t power;               // Output power in dBm
+    bool useBoost;              // PA_BOOST pin
+    uint8_t rf[7];              // FRF_MSB/MID/LSB, PA_CONFIG, PA_RAMP, OCP, LNA (0x06-0x0C)
+    uint8_t modem[5];           // MODEM_CONFIG_1/2, SYMB_TIMEOUT_LSB, PREAMBLE_MSB/LSB (0x1D-0x21)
+    uint8_t detectionOptimize;  // DETECTION_OPTIMIZE
+    uint8_t detectionThreshold; // DETECTION_THRESHOLD
+    uint8_t syncWord;           // SYNC_WORD
+    uint8_t paDac;              // PA_DAC
+
+private:
+    friend class SX1276;
+
+    // Uninitialized, target for copies from program memory
+    SX1276LoRaProfile() {}
+
+    // FRF is calculated once and split into bytes here
+    constexpr SX1276LoRaProfile(uint32_t frf, uint32_t freq, uint8_t bw, uint8_t sf, uint8_t cr, uint8_t syncWord,
+                                int8_t power, uint16_t preambleLength, bool crc, bool useBoost)
+        : freq(freq), power(power), useBoost(useBoost),
+          rf{ (uint8_t)(frf >> 16), (uint8_t)(frf >> 8), (uint8_t)frf, SX1276Reg::paConfig(power, useBoost),
+              0x09,             // PA_RAMP: 40 us (reset value)
+              0x20 | 0x1B,      // OCP: 240 mA
+              0x20 | 0x03 },    // LNA: G1, boost on
+          modem{ (uint8_t)(bw | cr), (uint8_t)((sf << 4) | (crc ? 0x04 : 0x00)),
+                 0x64,          // SYMB_TIMEOUT_LSB (reset value)
+                 (uint8_t)(preambleLength >> 8), (uint8_t)preambleLength },
+          detectionOptimize(sf == SX1276_SF_6 ? 0x05 : 0x03),
+          detectionThreshold(sf == SX1276_SF_6 ? 0x0C : 0x0A),
+          syncWord(syncWord), paDac(SX1276Reg::paDac(power, useBoost)) {}
+};
+#endif
+
+#ifdef FSK_OOK_ENABLED
+/**
+ * FSK/OOK configuration profile
+ * The constructor computes the register image, so a profile declared
+ * constexpr needs no runtime calculation (and no RAM with SX1276_PROGMEM on AVR).
+ * Apply with begin(), applyProfile() or applyProfile_P().
+ *
+ * Example:
+ *   constexpr SX1276FSKProfile profile(868300000UL, 8220, 57136, SX1276_RX_BW_125_0_KHZ_FSK,
+ *                                      17, 5, false, 0x2DD4, 2);
+ */
+struct SX1276FSKProfile {
+    /**
+     * Constructor
+     * @param freq Carrier frequency in Hz
+     * @param bitrate Bit rate in bps
+     * @param freqDev Frequency deviation in Hz (ignored for OOK)
+     * @param rxBw RX bandwidth (SX1276_RX_BW_* constants)
+     * @param power Output power in dBm
+     * @param preambleLength Preamble length in bytes
+     * @param ook OOK instead of FSK modulation
+     * @param syncWord Sync word, first byte in the most significant position
+     * @param syncWordLen Sync word length in bytes (1-8)
+     * @param fixedLength Fixed packet length (false: variable length)
+     * @param crc CRC on
+     * @param useBoost Use PA_BOOST pin
+     */
+    explicit constexpr SX1276FSKProfile(uint32_t freq, uint32_t bitrate = 4800, uint32_t freqDev = 5000,
+                               uint8_t rxBw = SX1276_RX_BW_10_4_KHZ_FSK, int8_t power = 17,
+                               uint16_t preambleLength = 5, bool ook = false,
+                               uint64_t syncWord = 0x12AD, uint8_t syncWordLen = 2,
+                               bool fixedLength = false, bool crc = true, bool useBoost = true)
+        : SX1276FSKProfile(SX1276Reg::frf(freq), SX1276Reg::bitrate(bitrate), SX1276Reg::fdev(freqDev),
+                           freq, bitrate, freqDev, rxBw, power, preambleLength, ook,
+                           syncWord, syncWordLen, fixedLength, crc, useBoost) {}
+
+    uint32_t freq;              // Carrier frequency in Hz
+    uint32_t bitrate;           // Bit rate in bps
+    uint32_t freqDev;           // Frequency deviation in Hz
+    int8_t power;               // Output power in dBm
+    bool useBoost;              // PA_BOOST pin
+    uint8_t modulation;         // SX1276_MODULATION_FSK or SX1276_MODULATION_OOK
+    uint8_t rf[8];              // BITRATE_MSB/LSB, FDEV_MSB/LSB, FRF_MSB/MID/LSB, PA_CONFIG (0x02-0x09)
+    uint8_t rxBw;               // RX_BW and AFC_BW
+    uint8_t syncWordLen;        // Sync word length in bytes
+    uint8_t sync[11];           // PREAMBLE_MSB/LSB, SYNC_CONFIG, SYNC_VALUE_1..8 (0x25-0x2F)
+    uint8_t packetConfig1;      // PACKET_CONFIG_1
+    uint8_t paDac;              // PA_DAC
+
+private:
+    friend class SX1276;
+
+    // Uninitialized, target for copies from program memory
+    SX1276FSKProfile() {}
+
+    // Register values are calculated once and split into bytes here
+    constexpr SX1276FSKProfile(uint32_t frf, uint16_t bitrateReg, uint16_t fdevReg,
+                               uint32_t freq, uint32_t bitrate, uint32_t freqDev, uint8_t rxBw, int8_t power,
+                               uint16_t preambleLength, bool ook, uint64_t syncWord, uint8_t syncWordLen,
+                               bool fixedLength, bool crc, bool useBoost)
+        : freq(freq), bitrate(bitrate), freqDev(freqDev), power(power), useBoost(useBoost),
+          modulation(ook ? SX1276_MODULATION_OOK : SX1276_MODULATION_FSK),
+          rf{ (uint8_t)(bitrateReg >> 8), (uint8_t)bitrateReg, (uint8_t)((fdevReg >> 8) & 0x3F), (uint8_t)fdevReg,
+              (uint8_t)(frf >> 16), (uint8_t)(frf >> 8), (uint8_t)frf, SX1276Reg::paConfig(power, useBoost) },
+          rxBw(rxBw), syncWordLen(syncWordLen),
+          sync{ (uint8_t)(preambleLength >> 8), (uint8_t)preambleLength,
+                (uint8_t)(0x90 | ((syncWordLen - 1) & 0x07)),  // Sync on, FIFO fill on sync address
+                syncByte(syncWord, syncWordLen, 0), syncByte(syncWord, syncWordLen, 1),
+                syncByte(syncWord, syncWordLen, 2), syncByte(syncWord, syncWordLen, 3),
+                syncByte(syncWord, syncWordLen, 4), syncByte(syncWord, syncWordLen, 5),
+                syncByte(syncWord, syncWordLen, 6), syncByte(syncWord, syncWordLen, 7) },
+          packetConfig1((uint8_t)((fixedLength ? 0x80 : 0x00) | (crc ? 0x10 : 0x00))),
+          paDac(SX1276Reg::paDac(power, useBoost)) {}
+
+    // Byte i of a sync word of len bytes (most significant byte first)
+    static constexpr uint8_t syncByte(uint64_t syncWord, uint8_t len, uint8_t i) {
+        return (i < len && len <= 8) ? (uint8_t)(syncWord >> (8 * (len - 1 - i))) : 0x00;
+    }
+};
+#endif
 
 /**
  * SX1276 class - flat hierarchy, no inheritance
@@ -271,10 +604,15 @@ public:
      * @param cs Chip select pin
      * @param irq DIO0 pin (interrupt/GPIO)
      * @param rst Reset pin
-     * @param gpio Additional GPIO pin (optional, defaults to -1 for unused)
+     * @param gpio DIO1 pin (optional, used for LoRa frequency hopping, -1 if not connected)
      */
     SX1276(int cs, int irq, int rst, int gpio = -1);
     
+    /**
+     * Destructor - releases the DIO0 interrupt
+     */
+    ~SX1276();
+    
     /**
      * Initialize the SX1276 module (simplified API)
      * @param freq Frequency in Hz (e.g., 915000000 for 915 MHz)
@@ -286,6 +624,22 @@ public:
     int16_t begin(long freq, int cs, int rst, int dio0);
     
 #ifdef LORA_ENABLED
+    /**
+     * Initialize the SX1276 module in LoRa mode (integer units, pins from the constructor)
+     * @param freq Carrier frequency in Hz (e.g., 915000000 for 915 MHz)
+     * @param bw LoRa bandwidth in Hz (7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000 or 500000)
+     * @param sf LoRa spreading factor (default: 9, range: 6-12)
+     * @param cr LoRa coding rate denominator (default: 7, range: 5-8)
+     * @param syncWord LoRa sync word (default: 0x12 for private networks, 0x34 for LoRaWAN)
+     * @param power Transmission output power in dBm (default: 10, range: 2-17)
+     * @param preambleLength Length of LoRa preamble in symbols (default: 8)
+     * @param gain Receiver LNA gain (default: 0 for automatic gain control)
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t beginLoRaHz(uint32_t freq = 434000000UL, uint32_t bw = 125000UL, uint8_t sf = 9, uint8_t cr = 7,
+                        uint8_t syncWord = 0x12, int8_t power = 10, uint16_t preambleLength = 8, uint8_t gain = 0);
+
+#ifdef SX1276_FLOAT_API
     /**
      * Initialize the SX1276 module in LoRa mode (RadioLib-compatible)
      * @param freq Carrier frequency in MHz (e.g., 915.0 for 915 MHz)
@@ -298,11 +652,30 @@ public:
      * @param gain Receiver LNA gain (default: 0 for automatic gain control)
      * @return Error code (SX1276_ERR_NONE on success)
      */
-    int16_t begin(float freq = 434.0, float bw = 125.0, uint8_t sf = 9, uint8_t cr = 7, 
-                  uint8_t syncWord = 0x12, int8_t power = 10, uint16_t preambleLength = 8, uint8_t gain = 0);
+    inline int16_t begin(float freq = 434.0, float bw = 125.0, uint8_t sf = 9, uint8_t cr = 7, 
+                         uint8_t syncWord = 0x12, int8_t power = 10, uint16_t preambleLength = 8, uint8_t gain = 0) {
+        return beginLoRaHz((uint32_t)(freq * 1000000.0 + 0.5), (uint32_t)(bw * 1000.0 + 0.5), sf, cr,
+                           syncWord, power, preambleLength, gain);
+    }
+#endif
 #endif
     
 #ifdef FSK_OOK_ENABLED
+    /**
+     * Initialize the SX1276 module in FSK/OOK mode (integer units, pins from the constructor)
+     * @param freq Carrier frequency in Hz (e.g., 434000000 for 434 MHz)
+     * @param br Bit rate in bps (default: 4800 bps)
+     * @param freqDev Frequency deviation in Hz (default: 5000 Hz, set to 0 for OOK)
+     * @param rxBw Receiver bandwidth in Hz (rounded up to the next supported value, default: 125000 Hz)
+     * @param power Transmission output power in dBm (default: 10, range: 2-17)
+     * @param preambleLength Length of FSK/OOK preamble in bytes (default: 5 bytes, min: 3)
+     * @param enableOOK Use OOK modulation instead of FSK (default: false)
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t beginFSKHz(uint32_t freq = 434000000UL, uint32_t br = 4800, uint32_t freqDev = 5000, uint32_t rxBw = 125000UL,
+                       int8_t power = 10, uint16_t preambleLength = 5, bool enableOOK = false);
+
+#ifdef SX1276_FLOAT_API
     /**
      * Initialize the SX1276 module in FSK/OOK mode (RadioLib-compatible)
      * @param freq Carrier frequency in MHz (e.g., 434.0 for 434 MHz)
@@ -314,10 +687,107 @@ public:
      * @param enableOOK Use OOK modulation instead of FSK (default: false)
      * @return Error code (SX1276_ERR_NONE on success)
      */
-    int16_t beginFSK(float freq = 434.0, float br = 4.8, float freqDev = 5.0, float rxBw = 125.0, 
-                     int8_t power = 10, uint16_t preambleLength = 5, bool enableOOK = false);
+    inline int16_t beginFSK(float freq = 434.0, float br = 4.8, float freqDev = 5.0, float rxBw = 125.0, 
+                            int8_t power = 10, uint16_t preambleLength = 5, bool enableOOK = false) {
+        return beginFSKHz((uint32_t)(freq * 1000000.0 + 0.5), (uint32_t)(br * 1000.0 + 0.5),
+                          (uint32_t)(freqDev * 1000.0 + 0.5), (uint32_t)(rxBw * 1000.0 + 0.5),
+                          power, preambleLength, enableOOK);
+    }
+#endif
+#endif
+    
+#ifdef LORA_ENABLED
+    /**
+     * Initialize the SX1276 module in LoRa mode from a configuration profile
+     * (pins from the constructor; no floating point and no runtime register calculation)
+     * @param profile Configuration profile
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t begin(const SX1276LoRaProfile& profile);
+    
+    /**
+     * Initialize in LoRa mode from a configuration profile in program memory
+     * @param profile Configuration profile declared with SX1276_PROGMEM
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t begin_P(const SX1276LoRaProfile* profile);
+    
+    /**
+     * Switch to LoRa mode and apply a configuration profile
+     * The register image is written with burst writes; the settings are
+     * taken over, so the setters can be used afterwards.
+     * @param profile Configuration profile
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t applyProfile(const SX1276LoRaProfile& profile);
+    
+    /**
+     * Switch to LoRa mode and apply a configuration profile in program memory
+     * @param profile Configuration profile declared with SX1276_PROGMEM
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t applyProfile_P(const SX1276LoRaProfile* profile);
+#endif
+    
+#ifdef FSK_OOK_ENABLED
+    /**
+     * Initialize the SX1276 module in FSK/OOK mode from a configuration profile
+     * (pins from the constructor; no floating point and no runtime register calculation)
+     * @param profile Configuration profile
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t begin(const SX1276FSKProfile& profile);
+    
+    /**
+     * Initialize in FSK/OOK mode from a configuration profile in program memory
+     * @param profile Configuration profile declared with SX1276_PROGMEM
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t begin_P(const SX1276FSKProfile* profile);
+    
+    /**
+     * Switch to FSK/OOK mode and apply a configuration profile
+     * The register image is written with burst writes; the settings are
+     * taken over, so the setters can be used afterwards.
+     * @param profile Configuration profile
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t applyProfile(const SX1276FSKProfile& profile);
+    
+    /**
+     * Switch to FSK/OOK mode and apply a configuration profile in program memory
+     * @param profile Configuration profile declared with SX1276_PROGMEM
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t applyProfile_P(const SX1276FSKProfile* profile);
 #endif
     
+    /**
+     * Get the duration of the last successful begin()/beginFSK()
+     * @return Time for reset, chip detection and configuration in us
+     */
+    uint32_t getStartupTime() const;
+    
+    /**
+     * Warm start after sleep (the SX1276 keeps its registers in sleep mode)
+     * Verifies key registers against the current configuration and skips
+     * reset and configuration if they match; otherwise falls back to a full
+     * reset and configuration. Pins and configuration must be set up as for
+     * begin() (constructor pins, setters or the previous begin() call).
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t resume();
+    
+    /**
+     * Warm start after sleep (simplified API, arguments as for begin())
+     * @param freq Frequency in Hz
+     * @param cs Chip select pin
+     * @param rst Reset pin
+     * @param dio0 DIO0 pin
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t resume(long freq, int cs, int rst, int dio0);
+    
     /**
      * Set modulation type
      * @param modulation Modulation type (SX1276_MODULATION_FSK, SX1276_MODULATION_OOK, or SX1276_MODULATION_LORA)
@@ -339,20 +809,135 @@ public:
     
     /**
      * Transmit data
+     * FSK/OOK packets larger than the 64-byte FIFO are streamed: the FIFO is
+     * refilled whenever FifoLevel (DIO1, or IRQ_FLAGS_2 if DIO1 is not connected) drops.
      * @param data Pointer to data buffer
-     * @param len Length of data (max SX1276_MAX_PACKET_LENGTH)
+     * @param len Length of data (max SX1276_MAX_PACKET_LENGTH, FSK/OOK fixed length
+     *            mode: SX1276_MAX_PACKET_LENGTH_FSK)
      * @return Error code (SX1276_ERR_NONE on success)
      */
     int16_t transmit(const uint8_t* data, size_t len);
     
+    /**
+     * Start transmitting data (non-blocking)
+     * Returns as soon as the packet is in the FIFO and the chip is in TX mode.
+     * Completion is signalled on DIO0 (TxDone/PacketSent), which is attached to
+     * an interrupt handler that only sets a flag; poll isTransmitDone() and
+     * call finishTransmit() when it returns true.
+     * FSK/OOK packets larger than the FIFO are refilled from isTransmitDone(),
+     * so poll it at least every SX1276_FIFO_THRESHOLD_FSK byte times and keep
+     * the data valid until the transmission has completed.
+     * @param data Pointer to data buffer
+     * @param len Length of data (as transmit())
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t startTransmit(const uint8_t* data, size_t len);
+    
+#ifdef SX1276_ASYNC_FIFO
+    /**
+     * Start transmitting data with the FIFO loaded in the background
+     * Returns once the transfer of the payload has been started (see
+     * startFifoWrite()). TX is entered when isTransmitDone() or
+     * isFifoTransferDone() finds the transfer completed; continue as after
+     * startTransmit(). Do not access the radio in between.
+     * @param data Pointer to data buffer (must stay valid until the transmission has completed)
+     * @param len Length of data (as transmit())
+     * @return Error code (SX1276_ERR_NONE on success, SX1276_ERR_BUSY if a transfer is in progress)
+     */
+    int16_t startTransmitAsync(const uint8_t* data, size_t len);
+#endif
+    
+    /**
+     * Check whether the transmission started by startTransmit() has completed
+     * No SPI access (except for servicing LoRa frequency hopping events,
+     * refilling the FSK FIFO and entering TX after startTransmitAsync()).
+     * @return true if the packet has been sent
+     */
+    bool isTransmitDone();
+    
+    /**
+     * Complete a transmission started by startTransmit()
+     * Clears the IRQ flags and returns to standby. Called before the packet has
+     * been sent, the transmission is aborted.
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t finishTransmit();
+    
     /**
      * Receive data (blocking)
+     * FSK/OOK packets larger than the 64-byte FIFO are drained on FifoLevel
+     * while they are being received (DIO1, or IRQ_FLAGS_2 if DIO1 is not connected).
      * @param data Pointer to buffer to store received data
      * @param maxLen Maximum length of buffer
      * @return Number of bytes received, or error code (< 0)
      */
     int16_t receive(uint8_t* data, size_t maxLen);
     
+    /**
+     * Start listening for a packet (non-blocking)
+     * The chip stays in RX mode until a packet has been received; RxDone
+     * (LoRa) or PayloadReady (FSK/OOK) on DIO0 sets the same interrupt flag
+     * as TxDone. Poll isPacketAvailable() and fetch the packet with readData().
+     * FSK/OOK packets must fit the 64-byte FIFO (use receive() for larger ones).
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t startReceive();
+    
+    /**
+     * Check whether a packet has been received after startReceive()
+     * No SPI access (except for servicing LoRa frequency hopping events).
+     * @return true if readData() will return a packet
+     */
+    bool isPacketAvailable();
+    
+    /**
+     * Read the packet received after startReceive() and return to standby
+     * Does not access the chip if no packet has arrived.
+     * @param data Pointer to buffer to store received data
+     * @param maxLen Maximum length of buffer
+     * @return Number of bytes received, or error code (< 0, SX1276_ERR_NO_PACKET if nothing has arrived yet)
+     */
+    int16_t readData(uint8_t* data, size_t maxLen);
+    
+#ifdef SX1276_ASYNC_FIFO
+    /**
+     * Read the packet received after startReceive() with the FIFO drained in the background
+     * Checks the packet and returns to standby like readData(), then starts
+     * the transfer of the payload (see startFifoRead()) and returns. The data
+     * is valid once isFifoTransferDone() has returned true; do not access the
+     * radio in between.
+     * @param data Pointer to buffer (must stay valid until the transfer is done)
+     * @param maxLen Maximum length of buffer
+     * @return Number of bytes being read, or error code (< 0, SX1276_ERR_NO_PACKET if nothing has arrived yet, SX1276_ERR_BUSY if a transfer is in progress)
+     */
+    int16_t readDataAsync(uint8_t* data, size_t maxLen);
+#endif
+    
+#ifdef SX1276_RX_QUEUE
+    /**
+     * Continuous reception: take received packets from the chip into the queue
+     * While the chip is in RX mode (after startReceive()), each packet signalled
+     * on DIO0 is copied into the queue together with its RSSI/SNR and the chip
+     * keeps listening. Call often enough to pick up every packet before the next
+     * one ends - the interrupt flag makes calls without a new packet free of SPI
+     * traffic. Packets with CRC errors are discarded.
+     * @return Number of packets in the queue
+     */
+    uint8_t available();
+    
+    /**
+     * Take the oldest packet from the queue (calls available() if it is empty)
+     * @param packet Packet data and metadata
+     * @return Number of bytes in packet.data, or SX1276_ERR_NO_PACKET
+     */
+    int16_t readPacket(SX1276Packet& packet);
+    
+    /**
+     * Number of packets discarded because the queue was full
+     */
+    uint16_t getQueueOverflows() const;
+#endif
+    
     /**
      * Set carrier frequency (simplified API with Hz)
      * @param freq Frequency in Hz
@@ -360,12 +945,69 @@ public:
      */
     int16_t setFrequency(long freq);
     
+#ifdef SX1276_FLOAT_API
     /**
      * Set carrier frequency (RadioLib-compatible with MHz)
      * @param freq Frequency in MHz (e.g., 915.0 for 915 MHz)
      * @return Error code (SX1276_ERR_NONE on success)
      */
-    int16_t setFrequency(float freq);
+    inline int16_t setFrequency(float freq) {
+        return setFrequency((long)(freq * 1000000.0 + 0.5));
+    }
+#endif
+    
+    /**
+     * Set a channel plan for hopTo()
+     * The table is not copied and must stay valid while it is used.
+     * Precompute the values with SX1276Reg::frf(), e.g.
+     *   static const uint32_t plan[] = { SX1276Reg::frf(868100000UL), SX1276Reg::frf(868300000UL) };
+     * @param frf Table of FRF register values
+     * @param count Number of channels (0 also switches frequency hopping off)
+     */
+    void setChannelPlan(const uint32_t* frf, uint8_t count);
+    
+    /**
+     * Set a channel plan in program memory (SX1276_PROGMEM) for hopTo()
+     * @param frf Table of FRF register values in program memory
+     * @param count Number of channels (0 also switches frequency hopping off)
+     */
+    void setChannelPlan_P(const uint32_t* frf, uint8_t count);
+    
+    /**
+     * Tune to a channel of the channel plan
+     * Writes FRF with one burst. In FSTX/FSRX, returns when the synthesizer has
+     * locked on the new frequency; in STDBY, the frequency is used from the next
+     * FS/TX/RX mode on. Other modes are left for standby first.
+     * @param channel Index in the channel plan
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t hopTo(uint8_t channel);
+    
+#ifdef LORA_ENABLED
+    /**
+     * Enable LoRa frequency hopping (FHSS) over the channel plan
+     * The modem hops every hopPeriod symbols during transmit() and receive();
+     * on each FhssChangeChannel event the driver writes the FRF of the next
+     * channel (channel plan index = hop count modulo number of channels).
+     * Connect DIO1 (constructor gpio) to service the events from the pin,
+     * otherwise the IRQ flags are polled. Both sides must use the same plan and period.
+     * @param hopPeriod Symbols per hop (0 = hopping off)
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t setFrequencyHopping(uint8_t hopPeriod);
+#endif
+    
+    /**
+     * Get carrier frequency as programmed in the FRF registers
+     * @return Frequency in Hz (rounded up to the next Hz)
+     */
+    uint32_t getFrequency();
+    
+    /**
+     * Set SPI clock frequency used for all register and FIFO accesses
+     * @param freq SCK frequency in Hz (limited to SX1276_SPI_MAX_FREQUENCY = 10 MHz)
+     */
+    void setSpiFrequency(uint32_t freq);
     
     /**
      * Set output power
@@ -479,13 +1121,71 @@ public:
      */
     int16_t setPacketConfig(bool fixedLength, bool crcOn);
     
+    /**
+     * Set the FSK/OOK payload length
+     * Fixed length mode: length of received packets (transmit() sets it to the
+     * length of the transmitted packet). Variable length mode: longest packet accepted.
+     * The length is kept across setPacketConfig(), modulation changes and resume()
+     * (variable length mode uses at most SX1276_MAX_PACKET_LENGTH of it).
+     * @param len Payload length (fixed length: max SX1276_MAX_PACKET_LENGTH_FSK,
+     *            variable length: max SX1276_MAX_PACKET_LENGTH)
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t setPayloadLength(uint16_t len);
+    
     /**
      * Get RSSI value in FSK/OOK mode
      * @return RSSI in dBm
      */
     int16_t getRSSI_FSK();
+    
+    /**
+     * Get bit rate as programmed in the BITRATE registers
+     * @return Bit rate in bps
+     */
+    uint32_t getBitrate();
+    
+    /**
+     * Get frequency deviation as programmed in the FDEV registers
+     * @return Frequency deviation in Hz (rounded up to the next Hz)
+     */
+    uint32_t getFrequencyDeviation();
 #endif
     
+    /**
+     * Read the on-chip temperature sensor
+     * The sensor only works in FSK/OOK mode: in LoRa mode the radio is switched
+     * to FSK/OOK and back (registers are retained). Afterwards the radio is in
+     * standby (sleep if it was sleeping).
+     * The sensor is not calibrated: -1 degree C per LSB, absolute offset of some degrees.
+     * @param temperature Temperature in degrees C
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t getTemperature(int8_t& temperature);
+    
+    /**
+     * Run image and RSSI calibration if needed
+     * Calibrates if the temperature has drifted by the threshold (see
+     * setCalibrationThreshold()) or the frequency band (137-175, 410-525,
+     * 862-1020 MHz) has changed since the last calibration, or on the first call.
+     * Mode handling as for getTemperature().
+     * @param force Calibrate unconditionally
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t calibrateImage(bool force = false);
+    
+    /**
+     * Set the temperature drift which makes calibrateImage() recalibrate
+     * @param degrees Drift in degrees C (default SX1276_CAL_TEMP_THRESHOLD)
+     */
+    void setCalibrationThreshold(uint8_t degrees);
+    
+    /**
+     * Get the duration of the calibration run by the last calibrateImage() call
+     * @return Calibration time in us (0 if the last call did not need to calibrate)
+     */
+    uint32_t getCalibrationTime() const;
+    
     /**
      * Set module to standby mode
      * @return Error code (SX1276_ERR_NONE on success)
@@ -498,6 +1198,28 @@ public:
      */
     int16_t sleep();
     
+    /**
+     * Lock the frequency synthesizer for a following transmit() (FSTX mode)
+     * transmit() then skips standby and only needs the PA ramp-up.
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t prepareTransmit();
+    
+    /**
+     * Lock the frequency synthesizer for a following receive() (FSRX mode)
+     * receive() then skips standby and only needs the receiver startup.
+     * @return Error code (SX1276_ERR_NONE on success)
+     */
+    int16_t prepareReceive();
+    
+    /**
+     * Get current operating mode as tracked by the driver
+     * Mode changes to the current mode are skipped. TX, RX single and CAD end
+     * by themselves - they are reported until the driver has observed the end.
+     * @return Operating mode (SX1276_MODE_*), SX1276_MODE_UNKNOWN before begin()
+     */
+    uint8_t getMode() const;
+    
     /**
      * Read a register
      * @param addr Register address
@@ -512,18 +1234,123 @@ public:
      */
     void writeRegister(uint8_t addr, uint8_t value);
 
+    /**
+     * Read consecutive registers in a single SPI transaction
+     * (uses the SX1276 address auto-increment; reading SX1276_REG_FIFO drains the FIFO)
+     * @param addr Address of the first register
+     * @param buf Buffer to store the register values
+     * @param len Number of registers to read
+     */
+    void readRegisterBurst(uint8_t addr, uint8_t* buf, size_t len);
+
+    /**
+     * Write consecutive registers in a single SPI transaction
+     * (uses the SX1276 address auto-increment; writing SX1276_REG_FIFO fills the FIFO)
+     * @param addr Address of the first register
+     * @param buf Values to write
+     * @param len Number of registers to write
+     */
+    void writeRegisterBurst(uint8_t addr, const uint8_t* buf, size_t len);
+
+#ifdef SX1276_ASYNC_FIFO
+    /**
+     * Start writing data to the FIFO in the background
+     * The SPI bus stays reserved for the transfer - do not access the radio
+     * until isFifoTransferDone() has returned true.
+     * @param data Pointer to data buffer (must stay valid until the transfer is done)
+     * @param len Length of data
+     * @return Error code (SX1276_ERR_NONE on success, SX1276_ERR_BUSY if a transfer is in progress)
+     */
+    int16_t startFifoWrite(const uint8_t* data, size_t len);
+
+    /**
+     * Start reading data from the FIFO in the background
+     * The SPI bus stays reserved for the transfer - do not access the radio
+     * until isFifoTransferDone() has returned true.
+     * @param data Pointer to buffer (must stay valid until the transfer is done)
+     * @param len Number of bytes to read
+     * @return Error code (SX1276_ERR_NONE on success, SX1276_ERR_BUSY if a transfer is in progress)
+     */
+    int16_t startFifoRead(uint8_t* data, size_t len);
+
+    /**
+     * Check whether the background FIFO transfer has completed
+     * Completes the SPI transaction when the transfer has finished, enters TX
+     * if the transfer was started by startTransmitAsync() and clears the rest
+     * of an FSK/OOK packet that did not fit the buffer of readDataAsync().
+     * @return true if no transfer is in progress
+     */
+    bool isFifoTransferDone();
+#endif
+
+    /**
+     * Reload the shadow register cache from the chip
+     * (only needed if the chip was reset or written to outside of this driver;
+     * no-op if SX1276_SHADOW_REGISTERS is not defined)
+     */
+    void resyncShadow();
+
+#ifdef SX1276_STATS
+    /**
+     * Get SPI instrumentation counters
+     * @return Counters per operation (index SX1276_STATS_*)
+     */
+    const SX1276Stats& getStats() const;
+
+    /**
+     * Reset SPI instrumentation counters
+     */
+    void resetStats();
+#endif
+
 private:
     // Pin assignments
     int _csPin;
     int _rstPin;
     int _dio0Pin;
+    int _dio1Pin;           // -1 if not connected
+
+    // Set on a rising edge of DIO0: TxDone/PacketSent or RxDone/PayloadReady
+    volatile bool _dio0Flag;
+    uint8_t _isrSlot;       // Index in _isrInstances, SX1276_NO_ISR_SLOT if no interrupt attached
+
+    // Radios with an attached DIO0 interrupt, one handler per slot
+    static SX1276* volatile _isrInstances[SX1276_MAX_INSTANCES];
+    static void (* const _dio0Isrs[SX1276_MAX_INSTANCES])();
+    static void SX1276_ISR_ATTR dio0Isr0();
+#if SX1276_MAX_INSTANCES > 1
+    static void SX1276_ISR_ATTR dio0Isr1();
+#endif
+#if SX1276_MAX_INSTANCES > 2
+    static void SX1276_ISR_ATTR dio0Isr2();
+#endif
+#if SX1276_MAX_INSTANCES > 3
+    static void SX1276_ISR_ATTR dio0Isr3();
+#endif
+
+    // Chip select resolved to port register and bit mask (set up in begin())
+    SX1276Hal::FastPin _csFast;
+
+    // SPI settings (constructed once, used for every transaction)
+    SX1276Hal::SpiSettings _spiSettings;
     
     // Current configuration
     uint32_t _freq;
+    uint32_t _startupTime;  // Duration of the last begin() in us
+    uint32_t _calTime;      // Duration of the last image calibration in us
+    int8_t _calTemp;        // Temperature at the last image calibration
+    uint8_t _calBand;       // Frequency band at the last image calibration, 0 = not calibrated
+    uint8_t _calThreshold;  // Temperature drift for recalibration
+    uint8_t _mode;          // OP_MODE as last written, SX1276_MODE_UNKNOWN if not known
     int8_t _power;
     bool _useBoost;
     uint8_t _modulation;  // Current modulation type
     
+    // Channel plan (FRF values, see setChannelPlan())
+    const uint32_t* _channelPlan;
+    uint8_t _channelCount;
+    bool _channelPlanP;   // Table in program memory
+    
     // LoRa configuration (if enabled)
 #ifdef LORA_ENABLED
     uint8_t _bw;
@@ -532,6 +1359,7 @@ private:
     uint16_t _preambleLength;
     uint8_t _syncWord;
     bool _crcEnabled;
+    uint8_t _hopPeriod;     // FHSS symbols per hop, 0 = off
 #endif
     
     // FSK/OOK configuration (if enabled)
@@ -544,25 +1372,142 @@ private:
     uint16_t _preambleLengthFSK;
     bool _fixedLength;
     bool _crcOnFSK;
+    uint16_t _payloadLengthFSK;  // setPayloadLength(), reapplied by config()/setPacketConfig()
     int16_t _lastRSSI;  // Cached RSSI value from last packet
+    
+    // FIFO streaming for packets larger than the FIFO
+    const uint8_t* _txData;   // Bytes not yet written to the FIFO
+    uint16_t _txRemaining;
+    uint8_t* _rxData;         // Destination of the packet being read
+    uint16_t _rxMaxLen;       // Size of _rxData, further bytes are discarded
+    uint16_t _rxLen;          // Payload length, SX1276_LENGTH_UNKNOWN before the length byte
+    uint16_t _rxRead;         // Payload bytes taken from the FIFO
+    bool _rxStreaming;        // receive() drains the FIFO during reception
+    uint32_t _fifoPollUs;     // FifoLevel polling interval without DIO1
+    uint32_t _fifoPollTime;   // Last FifoLevel poll (us)
+#endif
+
+    // Shadow copies of registers which are read-modify-written
+#ifdef SX1276_SHADOW_REGISTERS
+    uint8_t _shadowOpMode;
+    uint8_t _shadowLna;
+#ifdef LORA_ENABLED
+    uint8_t _shadowModemConfig1;
+    uint8_t _shadowModemConfig2;
+#endif
 #endif
     
+#ifdef SX1276_ASYNC_FIFO
+    bool _fifoBusy;  // Background FIFO transfer in progress
+    bool _txPending;  // startTransmitAsync(): enter TX when the transfer is done
+    int16_t _txError;  // Entering TX after the background load failed
+    bool _rxTruncated;  // readDataAsync(): clear the rest of the FSK packet from the FIFO when the transfer is done
+#endif
+
+#ifdef SX1276_RX_QUEUE
+    // Ring buffer of received packets
+    SX1276Packet _rxQueue[SX1276_RX_QUEUE_SIZE];
+    uint8_t _rxHead;          // Oldest packet
+    uint8_t _rxCount;         // Packets in the queue
+    uint16_t _rxOverflows;    // Packets discarded with a full queue
+#endif
+
+#ifdef SX1276_STATS
+    SX1276Stats _stats;
+    uint8_t _statsActive;     // Bit mask of operations in progress
+    uint32_t _statsBusStart;  // Start of the current SPI transaction (us)
+
+    // Counts an operation for the lifetime of the object (see SX1276_STATS_SCOPE)
+    class StatsScope {
+    public:
+        StatsScope(SX1276* radio, uint8_t op);
+        ~StatsScope();
+    private:
+        SX1276* _radio;
+        uint8_t _op;
+        uint8_t _mask;  // 0 if nested in a call of the same operation
+        uint32_t _start;
+    };
+
+    void statsCount(uint32_t transactions, uint32_t bytes, uint32_t busMicros);
+#endif
+
     // SPI communication helpers
     void spiBegin();
     void spiEnd();
     uint8_t spiTransfer(uint8_t data);
+    void spiWriteBuffer(const uint8_t* data, size_t len);
+    void spiReadBuffer(uint8_t* data, size_t len);
+
+#ifdef SX1276_ASYNC_FIFO
+    // Background FIFO transfer
+    int16_t startFifoTransfer(uint8_t addr, const uint8_t* tx, uint8_t* rx, size_t len);
+#endif
+
+#ifdef SX1276_RX_QUEUE
+    // Continuous reception: copy the packet signalled on DIO0 into the queue
+    void queuePacket();
+#endif
+
+    // Shadow register cache helpers
+    uint8_t readShadow(uint8_t addr);
+    void updateShadow(uint8_t addr, uint8_t value);
+    void resetShadow();
+    
+    // Transmission
+    int16_t loadTransmit(const uint8_t* data, size_t len, bool background);
+    int16_t enterTransmit();
     
     // Module control
+    void initHardware();
+    void releaseInterrupt();
+    int16_t startup();
+    bool verifyConfig();
     int16_t reset();
     int16_t setMode(uint8_t mode);
     int16_t config();
+
+#ifdef LORA_ENABLED
+    void setDetectionOptimize(uint8_t sf);
     
+    // Frequency hopping: FRF of the next channel on FhssChangeChannel (true if hopped)
+    bool serviceHopping();
+    void stopHopping();
+#endif
+
 #ifdef FSK_OOK_ENABLED
     int16_t configFSK();
+    uint32_t rxWakeupTimeUs();
+    
+    // FIFO streaming
+    void payloadLengthRegs(bool fixedLength, uint8_t* regs);
+    int8_t fifoLevel();
+    void refillFifo();
+    void drainFifo();
+    void readFifoPayload(uint16_t count);
 #endif
+
+    
+    // Register value conversion
+    uint32_t frequencyToFrf(uint32_t freq);
+    void powerToPaConfig(int8_t power, bool useBoost, uint8_t& paConfig, uint8_t& paDac);
+    
+    // FRF register access
+    void writeFrf(uint32_t frf);
+    uint32_t channelFrf(uint8_t channel);
+    
+    // Mode tracking
+    bool isPersistentMode(uint8_t opMode);
+    bool samePllSide(uint8_t from, uint8_t to);
     
     // Wait for mode ready
-    void waitForModeReady();
+    int16_t waitForModeReady(uint8_t previous, uint8_t opMode);
+    
+    // Temperature sensor and image calibration (FSK/OOK page, see getTemperature())
+    int16_t enterFskStandby(uint8_t& savedOpMode);
+    int16_t leaveFskStandby(uint8_t savedOpMode);
+    int16_t measureTemperature(int8_t& temperature);
+    uint8_t frequencyBand(uint32_t freq);
 };
 
 #endif // SX1276_H
@@ -0,0 +1,269 @@
+/**
+ * SX1276Hal.h
+ *
+ * SX1276_Radio_Lite - Lightweight SX1276 radio library for Arduino
+ * Hardware abstraction layer (SPI, GPIO and timing)
+ *
+ * The implementation is selected at compile time:
+ * - Arduino builds (ARDUINO defined) use the Arduino core API
+ * - All other builds use the host implementation in SX1276HalHost.h,
+ *   which connects the driver to a simulated chip
+ *
+ * All functions are static inline, so the abstraction has no runtime cost.
+ *
+ * Copyright (c) 2024 Matthias Prinke
+ * Licensed under MIT License
+ */
+
+#ifndef SX1276_HAL_H
+#define SX1276_HAL_H
+
+#if defined(ARDUINO)
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+#elif defined(ARDUINO_ARCH_RP2040)
+#include <hardware/structs/sio.h>
+#endif
+
+// Constant data in flash (see SX1276Hal::readProgmem())
+#if defined(__AVR__)
+#define SX1276_PROGMEM PROGMEM
+#else
+#define SX1276_PROGMEM
+#endif
+
+// Interrupt handlers must be in RAM on ESP32/ESP8266
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+#define SX1276_ISR_ATTR IRAM_ATTR
+#else
+#define SX1276_ISR_ATTR
+#endif
+
+/**
+ * Arduino implementation
+ */
+struct SX1276Hal {
+    typedef SPISettings SpiSettings;
+
+    // SPI bus
+    static inline void spiInit() { SPI.begin(); }
+    static inline void spiDeinit() { SPI.end(); }
+    static inline void spiBeginTransaction(const SpiSettings& settings) { SPI.beginTransaction(settings); }
+    static inline void spiEndTransaction() { SPI.endTransaction(); }
+    static inline uint8_t spiTransfer(uint8_t data) { return SPI.transfer(data); }
+
+    /**
+     * Write a buffer (within a transaction)
+     * Uses the core's block transfer where it does not modify the source buffer
+     */
+    static inline void spiWrite(const uint8_t* data, size_t len) {
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+        SPI.writeBytes(data, len);
+#elif defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+        SPI.transfer(data, nullptr, len);
+#else
+        // AVR and others: block transfer works in place and would overwrite the data
+        for (size_t i = 0; i < len; i++) {
+            SPI.transfer(data[i]);
+        }
+#endif
+    }
+
+    /**
+     * Read into a buffer (within a transaction)
+     * The SX1276 ignores MOSI during a burst read, so the buffer is transferred in place
+     */
+    static inline void spiRead(uint8_t* data, size_t len) {
+        if (len == 0) {
+            return;
+        }
+        SPI.transfer(data, len);
+    }
+
+    /**
+     * Start a background transfer (within a transaction)
+     * Returns false if the platform has no background transfer
+     */
+    static inline bool spiStartAsync(const uint8_t* tx, uint8_t* rx, size_t len) {
+#if defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+        // arduino-pico: DMA channels for TX and RX, nullptr selects a dummy source/sink
+        return SPI.transferAsync(tx, rx, len);
+#else
+        (void)tx;
+        (void)rx;
+        (void)len;
+        return false;
+#endif
+    }
+
+    /**
+     * Check whether the background transfer has completed
+     */
+    static inline bool spiAsyncDone() {
+#if defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+        return SPI.finishedAsync();
+#else
+        return true;
+#endif
+    }
+
+    // GPIO
+    static inline void pinMode(int pin, uint8_t mode) { ::pinMode(pin, mode); }
+    static inline void digitalWrite(int pin, uint8_t value) { ::digitalWrite(pin, value); }
+    static inline int digitalRead(int pin) { return ::digitalRead(pin); }
+
+    /**
+     * Call isr on the rising edge of an input pin
+     * Pins without interrupt capability are ignored (the driver also checks the pin level).
+     */
+    static inline void attachInterrupt(int pin, void (*isr)()) {
+        int irq = digitalPinToInterrupt(pin);
+#if defined(NOT_AN_INTERRUPT)
+        if (irq == NOT_AN_INTERRUPT) {
+            return;
+        }
+#endif
+        ::attachInterrupt(irq, isr, RISING);
+    }
+
+    static inline void detachInterrupt(int pin) {
+        int irq = digitalPinToInterrupt(pin);
+#if defined(NOT_AN_INTERRUPT)
+        if (irq == NOT_AN_INTERRUPT) {
+            return;
+        }
+#endif
+        ::detachInterrupt(irq);
+    }
+
+    /**
+     * Output pin resolved to its port register and bit mask (used for chip select)
+     * Avoids the pin table lookups of digitalWrite() on every SPI transaction.
+     */
+#if defined(__AVR__)
+    struct FastPin {
+        FastPin() : out(&sink()), mask(0) {}
+        volatile uint8_t* out;
+        uint8_t mask;
+    };
+
+    static inline volatile uint8_t& sink() {
+        static volatile uint8_t dummy;
+        return dummy;
+    }
+
+    static inline FastPin fastPin(int pin) {
+        FastPin p;
+        uint8_t port = (pin >= 0) ? digitalPinToPort(pin) : NOT_A_PIN;
+        if (port != NOT_A_PIN) {
+            p.out = portOutputRegister(port);
+            p.mask = digitalPinToBitMask(pin);
+        }
+        return p;
+    }
+
+    // Read-modify-write of the port register - protect against ISRs writing the same port
+    static inline void fastPinHigh(const FastPin& p) {
+        uint8_t sreg = SREG;
+        cli();
+        *p.out |= p.mask;
+        SREG = sreg;
+    }
+
+    static inline void fastPinLow(const FastPin& p) {
+        uint8_t sreg = SREG;
+        cli();
+        *p.out &= ~p.mask;
+        SREG = sreg;
+    }
+#elif defined(ARDUINO_ARCH_ESP32)
+    struct FastPin {
+        FastPin() : set(GPIO_OUT_W1TS_REG), clr(GPIO_OUT_W1TC_REG), mask(0) {}
+        uint32_t set;
+        uint32_t clr;
+        uint32_t mask;
+    };
+
+    static inline FastPin fastPin(int pin) {
+        FastPin p;
+        if (pin >= 0 && pin < 32) {
+            p.mask = 1UL << pin;
+#if defined(GPIO_OUT1_W1TS_REG)
+        } else if (pin >= 32) {
+            p.set = GPIO_OUT1_W1TS_REG;
+            p.clr = GPIO_OUT1_W1TC_REG;
+            p.mask = 1UL << (pin - 32);
+#endif
+        }
+        return p;
+    }
+
+    // Write-1-to-set/clear registers - atomic, no read-modify-write
+    static inline void fastPinHigh(const FastPin& p) { REG_WRITE(p.set, p.mask); }
+    static inline void fastPinLow(const FastPin& p) { REG_WRITE(p.clr, p.mask); }
+#elif defined(ARDUINO_ARCH_RP2040)
+    struct FastPin {
+        FastPin() : mask(0) {}
+        uint32_t mask;
+    };
+
+    static inline FastPin fastPin(int pin) {
+        FastPin p;
+        if (pin >= 0 && pin < 32) {
+            p.mask = 1UL << pin;
+        }
+        return p;
+    }
+
+    // SIO set/clear registers - single cycle, atomic
+    static inline void fastPinHigh(const FastPin& p) { sio_hw->gpio_set = p.mask; }
+    static inline void fastPinLow(const FastPin& p) { sio_hw->gpio_clr = p.mask; }
+#else
+    // No direct port access - fall back to digitalWrite()
+    struct FastPin {
+        FastPin() : pin(-1) {}
+        int pin;
+    };
+
+    static inline FastPin fastPin(int pin) {
+        FastPin p;
+        p.pin = pin;
+        return p;
+    }
+
+    static inline void fastPinHigh(const FastPin& p) { ::digitalWrite(p.pin, HIGH); }
+    static inline void fastPinLow(const FastPin& p) { ::digitalWrite(p.pin, LOW); }
+#endif
+
+    /**
+     * Copy constant data declared with SX1276_PROGMEM
+     * (AVR flash is not in the data address space)
+     */
+    static inline void readProgmem(void* dst, const void* src, size_t len) {
+#if defined(__AVR__)
+        memcpy_P(dst, src, len);
+#else
+        memcpy(dst, src, len);
+#endif
+    }
+
+    // Timing
+    static inline void delay(uint32_t ms) { ::delay(ms); }
+    static inline void delayMicroseconds(uint32_t us) { ::delayMicroseconds(us); }
+    static inline uint32_t millis() { return ::millis(); }
+    static inline uint32_t micros() { return ::micros(); }
+    static inline void yield() { ::yield(); }
+};
+
+#else
+
+#include "SX1276HalHost.h"
+
+#endif
+
+#endif // SX1276_HAL_H
@@ -0,0 +1,302 @@
+/**
+ * SX1276HalHost.h
+ *
+ * SX1276_Radio_Lite - Lightweight SX1276 radio library for Arduino
+ * Host (non-Arduino) implementation of the hardware abstraction layer
+ *
+ * Lets the driver build and run on a PC, e.g. for benchmarks and
+ * regression tests. SPI bytes and GPIO accesses are forwarded to a
+ * simulated device (SX1276HostDevice) and time is virtual: it only
+ * advances by the SPI transfer time and by delay()/yield() calls.
+ *
+ * Usage:
+ *   MyDevice chip;
+ *   SX1276Hal::attach(&chip);
+ *   SX1276 radio;
+ *   radio.begin(868000000L, CS, RST, DIO0);
+ *
+ * Do not include directly - included by SX1276Hal.h.
+ *
+ * Copyright (c) 2024 Matthias Prinke
+ * Licensed under MIT License
+ */
+
+#ifndef SX1276_HAL_HOST_H
+#define SX1276_HAL_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Arduino constants used by the driver
+#ifndef HIGH
+#define HIGH        1
+#define LOW         0
+#endif
+#ifndef INPUT
+#define INPUT       0
+#define OUTPUT      1
+#endif
+#ifndef MSBFIRST
+#define MSBFIRST    1
+#endif
+#ifndef SPI_MODE0
+#define SPI_MODE0   0
+#endif
+
+// Constant data in flash (see SX1276Hal::readProgmem())
+#define SX1276_PROGMEM
+
+// Interrupt handler attribute
+#define SX1276_ISR_ATTR
+
+/**
+ * Simulated device connected to the host HAL
+ */
+class SX1276HostDevice {
+public:
+    virtual ~SX1276HostDevice() {}
+
+    /**
+     * Exchange one byte on the SPI bus (chip select is signalled via writePin())
+     * @param data Byte on MOSI
+     * @return Byte on MISO
+     */
+    virtual uint8_t transfer(uint8_t data) = 0;
+
+    /**
+     * Output pin driven by the driver (chip select, reset)
+     */
+    virtual void writePin(int pin, int value) { (void)pin; (void)value; }
+
+    /**
+     * Input pin read by the driver (DIOx)
+     */
+    virtual int readPin(int pin) { (void)pin; return LOW; }
+
+    /**
+     * Virtual time has advanced
+     * @param nowNs Current virtual time in nanoseconds
+     */
+    virtual void tick(uint64_t nowNs) { (void)nowNs; }
+};
+
+/**
+ * Host implementation
+ */
+struct SX1276Hal {
+    struct SpiSettings {
+        SpiSettings() : clock(4000000) {}
+        SpiSettings(uint32_t clockHz, uint8_t bitOrder, uint8_t dataMode) : clock(clockHz) {
+            (void)bitOrder;
+            (void)dataMode;
+        }
+        uint32_t clock;
+    };
+
+    // Pin change interrupt (rising edge)
+    struct Interrupt {
+        int pin;                // -1 if unused
+        void (*isr)();
+        int level;              // Last level seen
+    };
+
+    static const int maxInterrupts = 4;
+
+    // Host bus, clock, fake DMA engine and interrupt state
+    struct State {
+        SX1276HostDevice* device;
+        uint64_t nowNs;
+        uint32_t spiClock;
+        const uint8_t* dmaTx;
+        uint8_t* dmaRx;
+        size_t dmaLen;
+        uint64_t dmaDoneNs;
+        bool dmaActive;
+        Interrupt irq[maxInterrupts];
+    };
+
+    static inline State& state() {
+        static State s = { nullptr, 0, 4000000, nullptr, nullptr, 0, 0, false,
+                           { { -1, nullptr, LOW }, { -1, nullptr, LOW }, { -1, nullptr, LOW }, { -1, nullptr, LOW } } };
+        return s;
+    }
+
+    /**
+     * Connect the simulated device
+     */
+    static inline void attach(SX1276HostDevice* device) { state().device = device; }
+
+    /**
+     * Advance virtual time and let the device catch up
+     */
+    static inline void advance(uint64_t ns) {
+        State& s = state();
+        s.nowNs += ns;
+        if (s.device != nullptr) {
+            s.device->tick(s.nowNs);
+            pollInterrupts();
+        }
+    }
+
+    /**
+     * Call the handlers of pins which went high since the last check
+     */
+    static inline void pollInterrupts() {
+        State& s = state();
+        for (int i = 0; i < maxInterrupts; i++) {
+            Interrupt& irq = s.irq[i];
+            if (irq.pin < 0) {
+                continue;
+            }
+            int level = s.device->readPin(irq.pin);
+            if (level == HIGH && irq.level == LOW) {
+                irq.level = level;
+                irq.isr();
+            }
+            irq.level = level;
+        }
+    }
+
+    /**
+     * Current virtual time in nanoseconds
+     */
+    static inline uint64_t nanos() { return state().nowNs; }
+
+    /**
+     * Duration of one byte on the bus at the current SPI clock
+     */
+    static inline uint64_t byteTimeNs() { return 8000000000ULL / state().spiClock; }
+
+    // SPI bus
+    static inline void spiInit() {}
+    static inline void spiDeinit() {}
+    static inline void spiBeginTransaction(const SpiSettings& settings) { state().spiClock = settings.clock; }
+    static inline void spiEndTransaction() {}
+
+    static inline uint8_t spiTransfer(uint8_t data) {
+        advance(byteTimeNs());
+        SX1276HostDevice* device = state().device;
+        return (device != nullptr) ? device->transfer(data) : 0xFF;
+    }
+
+    static inline void spiWrite(const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            spiTransfer(data[i]);
+        }
+    }
+
+    static inline void spiRead(uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            data[i] = spiTransfer(0x00);
+        }
+    }
+
+    /**
+     * Start a background transfer on the fake DMA engine
+     * The transfer completes once virtual time has advanced by its bus time.
+     */
+    static inline bool spiStartAsync(const uint8_t* tx, uint8_t* rx, size_t len) {
+        State& s = state();
+        s.dmaTx = tx;
+        s.dmaRx = rx;
+        s.dmaLen = len;
+        s.dmaDoneNs = s.nowNs + len * byteTimeNs();
+        s.dmaActive = true;
+        return true;
+    }
+
+    /**
+     * Check whether the fake DMA transfer has completed
+     * The bytes are exchanged with the device on completion (bus time is already accounted for).
+     */
+    static inline bool spiAsyncDone() {
+        State& s = state();
+        if (!s.dmaActive) {
+            return true;
+        }
+        if (s.nowNs < s.dmaDoneNs) {
+            return false;
+        }
+        for (size_t i = 0; i < s.dmaLen; i++) {
+            uint8_t out = (s.dmaTx != nullptr) ? s.dmaTx[i] : 0x00;
+            uint8_t in = (s.device != nullptr) ? s.device->transfer(out) : 0xFF;
+            if (s.dmaRx != nullptr) {
+                s.dmaRx[i] = in;
+            }
+        }
+        s.dmaActive = false;
+        return true;
+    }
+
+    // GPIO
+    static inline void pinMode(int pin, uint8_t mode) { (void)pin; (void)mode; }
+
+    static inline void digitalWrite(int pin, uint8_t value) {
+        SX1276HostDevice* device = state().device;
+        if (device != nullptr) {
+            device->writePin(pin, value);
+        }
+    }
+
+    static inline int digitalRead(int pin) {
+        SX1276HostDevice* device = state().device;
+        return (device != nullptr) ? device->readPin(pin) : LOW;
+    }
+
+    // Pin change interrupts, checked whenever virtual time advances
+    static inline void attachInterrupt(int pin, void (*isr)()) {
+        State& s = state();
+        int free = -1;
+        for (int i = 0; i < maxInterrupts; i++) {
+            if (s.irq[i].pin == pin) {
+                free = i;
+                break;
+            }
+            if (s.irq[i].pin < 0 && free < 0) {
+                free = i;
+            }
+        }
+        if (free >= 0) {
+            s.irq[free].pin = pin;
+            s.irq[free].isr = isr;
+            s.irq[free].level = digitalRead(pin);
+        }
+    }
+
+    static inline void detachInterrupt(int pin) {
+        State& s = state();
+        for (int i = 0; i < maxInterrupts; i++) {
+            if (s.irq[i].pin == pin) {
+                s.irq[i].pin = -1;
+            }
+        }
+    }
+
+    // Fast output pin (chip select) - forwarded to the device like digitalWrite()
+    struct FastPin {
+        FastPin() : pin(-1) {}
+        int pin;
+    };
+
+    static inline FastPin fastPin(int pin) {
+        FastPin p;
+        p.pin = pin;
+        return p;
+    }
+
+    static inline void fastPinHigh(const FastPin& p) { digitalWrite(p.pin, HIGH); }
+    static inline void fastPinLow(const FastPin& p) { digitalWrite(p.pin, LOW); }
+
+    // Constant data (no separate program memory)
+    static inline void readProgmem(void* dst, const void* src, size_t len) { memcpy(dst, src, len); }
+
+    // Timing (virtual)
+    static inline void delay(uint32_t ms) { advance((uint64_t)ms * 1000000ULL); }
+    static inline void delayMicroseconds(uint32_t us) { advance((uint64_t)us * 1000ULL); }
+    static inline uint32_t millis() { return (uint32_t)(state().nowNs / 1000000ULL); }
+    static inline uint32_t micros() { return (uint32_t)(state().nowNs / 1000ULL); }
+    static inline void yield() { advance(1000); }  // A loop iteration on the target takes about 1 us
+};
+
+#endif // SX1276_HAL_HOST_H
@@ -0,0 +1,885 @@
+/**
+ * SX1276Emulator.cpp
+ *
+ * SX1276_Radio_Lite - Lightweight SX1276 radio library for Arduino
+ * Register-level behavioral model of the SX1276 for host builds
+ *
+ * Copyright (c) 2024 Matthias Prinke
+ * Licensed under MIT License
+ */
+
+#include "SX1276Emulator.h"
+
+#include <math.h>
+
+// FSK FIFO size
+#define SX1276_EMU_FSK_FIFO_SIZE    64
+
+// Modes which need the frequency synthesizer
+static bool usesPll(uint8_t mode) {
+    return mode >= SX1276_MODE_FSTX;
+}
+
+// FSTX/TX use the TX frequency, FSRX/RX/CAD the RX frequency
+static bool samePllSide(uint8_t from, uint8_t to) {
+    bool fromTx = (from == SX1276_MODE_FSTX || from == SX1276_MODE_TX);
+    bool toTx = (to == SX1276_MODE_FSTX || to == SX1276_MODE_TX);
+    return (fromTx && toTx) || (from >= SX1276_MODE_FSRX && to >= SX1276_MODE_FSRX);
+}
+
+static bool isRxMode(uint8_t mode) {
+    return mode == SX1276_MODE_RX_CONTINUOUS || mode == SX1276_MODE_RX_SINGLE;
+}
+
+/**
+ * Constructor
+ */
+SX1276Emulator::SX1276Emulator(int cs, int rst, int dio0, int dio1) {
+    _csPin = cs;
+    _rstPin = rst;
+    _dio0Pin = dio0;
+    _dio1Pin = dio1;
+    _now = 0;
+    _selected = false;
+    _inReset = false;
+    _byteIndex = 0;
+    _addr = 0;
+    _write = false;
+    _dropped = 0;
+    _temperature = 25;
+    resetStats();
+    powerOn();
+}
+
+/**
+ * Power-on reset
+ */
+void SX1276Emulator::powerOn() {
+    loadDefaults();
+    _readyAt = _now;
+}
+
+/**
+ * Load register reset values and clear the dynamic state
+ */
+void SX1276Emulator::loadDefaults() {
+    memset(_regFsk, 0, sizeof(_regFsk));
+    memset(_regLoRa, 0, sizeof(_regLoRa));
+    memset(_loraFifo, 0, sizeof(_loraFifo));
+    _fskFifo.clear();
+
+    // Common registers
+    _opMode = 0x09;             // FSK, LowFrequencyModeOn, STDBY
+    _regFsk[0x02] = 0x1A;       // 4.8 kbps
+    _regFsk[0x03] = 0x0B;
+    _regFsk[0x04] = 0x00;       // 5 kHz
+    _regFsk[0x05] = 0x52;
+    _regFsk[0x06] = 0x6C;       // 434 MHz
+    _regFsk[0x07] = 0x80;
+    _regFsk[0x08] = 0x00;
+    _regFsk[0x09] = 0x4F;
+    _regFsk[0x0A] = 0x09;
+    _regFsk[0x0B] = 0x2B;
+    _regFsk[0x0C] = 0x20;
+    _regFsk[0x40] = 0x00;
+    _regFsk[0x41] = 0x00;
+    _regFsk[0x42] = 0x12;       // Version
+    _regFsk[0x44] = 0x2D;
+    _regFsk[0x4B] = 0x09;
+    _regFsk[0x4D] = 0x84;
+
+    // FSK/OOK page
+    _regFsk[0x0D] = 0x08;
+    _regFsk[0x0E] = 0x02;
+    _regFsk[0x0F] = 0x0A;
+    _regFsk[0x10] = 0xFF;
+    _regFsk[0x12] = 0x15;
+    _regFsk[0x13] = 0x0B;
+    _regFsk[0x14] = 0x28;
+    _regFsk[0x15] = 0x0C;
+    _regFsk[0x16] = 0x12;
+    _regFsk[0x1F] = 0x40;
+    _regFsk[0x24] = 0x07;
+    _regFsk[0x26] = 0x03;
+    _regFsk[0x27] = 0x93;
+    for (uint8_t addr = 0x28; addr <= 0x2F; addr++) {
+        _regFsk[addr] = 0x01;
+    }
+    _regFsk[0x30] = 0x90;
+    _regFsk[0x31] = 0x40;
+    _regFsk[0x32] = 0x40;
+    _regFsk[0x35] = 0x1F;
+    _regFsk[0x39] = 0xF5;
+    _regFsk[0x3A] = 0x20;
+    _regFsk[0x3B] = 0x82;
+    _regFsk[0x3D] = 0x02;
+
+    // LoRa page
+    _regLoRa[0x0E] = 0x80;
+    _regLoRa[0x1D] = 0x72;
+    _regLoRa[0x1E] = 0x70;
+    _regLoRa[0x1F] = 0x64;
+    _regLoRa[0x21] = 0x08;
+    _regLoRa[0x22] = 0x01;
+    _regLoRa[0x23] = 0xFF;
+    _regLoRa[0x31] = 0xC3;
+    _regLoRa[0x33] = 0x27;
+    _regLoRa[0x37] = 0x0A;
+    _regLoRa[0x39] = 0x12;
+
+    _loraIrq = 0;
+    _irq1 = 0;
+    _irq2 = 0;
+
+    _modeReadyAt = _now;
+    _pllLockAt = UINT64_MAX;
+    _txState = TX_IDLE;
+    _txStartNs = 0;
+    _txEndNs = 0;
+    _txTotal = 0;
+    _txSent = 0;
+    _rxActive = false;
+    _rxDelivered = 0;
+    _rxDataStartNs = 0;
+    _hopNextNs = UINT64_MAX;
+    _imageCalDoneAt = 0;
+}
+
+/**
+ * Reset counters
+ */
+void SX1276Emulator::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_writeCount, 0, sizeof(_writeCount));
+}
+
+/**
+ * Schedule a packet on air
+ */
+void SX1276Emulator::injectPacket(const uint8_t* data, size_t len, uint64_t startNs, bool crcOk, int16_t rssi) {
+    Packet packet;
+    packet.data.assign(data, data + len);
+    packet.startNs = startNs;
+    packet.crcOk = crcOk;
+    packet.rssi = rssi;
+
+    // Keep the queue ordered by start time
+    std::deque<Packet>::iterator it = _air.begin();
+    while (it != _air.end() && it->startNs <= startNs) {
+        ++it;
+    }
+    _air.insert(it, packet);
+}
+
+/**
+ * Exchange one byte on the SPI bus
+ */
+uint8_t SX1276Emulator::transfer(uint8_t data) {
+    _stats.bytes++;
+
+    // Not selected, held in reset or still starting up: MISO is not driven
+    if (!_selected || _inReset || _now < _readyAt) {
+        return 0x00;
+    }
+
+    uint8_t result = 0x00;
+    if (_byteIndex == 0) {
+        _addr = data & 0x7F;
+        _write = (data & 0x80) != 0;
+        if (_write) {
+            _stats.registerWrites++;
+        } else {
+            _stats.registerReads++;
+        }
+    } else {
+        if (_write) {
+            writeReg(_addr, data);
+        } else {
+            result = readReg(_addr);
+        }
+
+        // Address auto-increment (the FIFO address does not increment)
+        if (_addr != SX1276_REG_FIFO) {
+            _addr = (_addr + 1) & 0x7F;
+        }
+    }
+    _byteIndex++;
+    return result;
+}
+
+/**
+ * Output pin driven by the driver
+ */
+void SX1276Emulator::writePin(int pin, int value) {
+    if (pin == _csPin) {
+        if (value == LOW && !_selected) {
+            _selected = true;
+            _byteIndex = 0;
+            _stats.transactions++;
+        } else if (value != LOW) {
+            _selected = false;
+        }
+    } else if (pin == _rstPin) {
+        if (value == LOW) {
+            _inReset = true;
+        } else if (_inReset) {
+            // Rising edge: registers back to defaults, chip ready after startup
+            _inReset = false;
+            loadDefaults();
+            _readyAt = _now + _timing.resetNs;
+            _stats.resets++;
+        }
+    }
+}
+
+/**
+ * Input pin read by the driver
+ */
+int SX1276Emulator::readPin(int pin) {
+    if (pin == _dio0Pin) {
+        return dio(0) ? HIGH : LOW;
+    }
+    if (pin == _dio1Pin) {
+        return dio(1) ? HIGH : LOW;
+    }
+    return LOW;
+}
+
+/**
+ * Virtual time has advanced
+ */
+void SX1276Emulator::tick(uint64_t nowNs) {
+    _now = nowNs;
+    process();
+}
+
+/**
+ * Level of a DIO line according to DIO_MAPPING_1
+ */
+int SX1276Emulator::dio(uint8_t index) const {
+    uint8_t mapping = _regFsk[SX1276_REG_DIO_MAPPING_1];
+
+    if (index == 0) {
+        mapping = (mapping >> 6) & 0x03;
+        if (isLoRa()) {
+            // 00: RxDone, 01: TxDone, 10: CadDone
+            const uint8_t flags[4] = { SX1276_IRQ_RX_DONE, SX1276_IRQ_TX_DONE, SX1276_IRQ_CAD_DONE, 0x00 };
+            return (_loraIrq & flags[mapping]) ? 1 : 0;
+        }
+        // Packet mode - 00: PayloadReady (RX) / PacketSent (TX), 01: CrcOk (RX)
+        uint8_t irq2 = fskIrq2();
+        if (mapping == 0) {
+            return (irq2 & (mode() == SX1276_MODE_TX ? SX1276_IRQ2_PACKET_SENT : SX1276_IRQ2_PAYLOAD_READY)) ? 1 : 0;
+        }
+        if (mapping == 1 && mode() != SX1276_MODE_TX) {
+            return (irq2 & SX1276_IRQ2_CRC_OK) ? 1 : 0;
+        }
+        return 0;
+    }
+
+    if (index == 1) {
+        mapping = (mapping >> 4) & 0x03;
+        if (isLoRa()) {
+            // 00: RxTimeout, 01: FhssChangeChannel, 10: CadDetected
+            const uint8_t flags[4] = { SX1276_IRQ_RX_TIMEOUT, SX1276_IRQ_FHSS_CHANGE_CHANNEL, SX1276_IRQ_CAD_DETECTED, 0x00 };
+            return (_loraIrq & flags[mapping]) ? 1 : 0;
+        }
+        // 00: FifoLevel, 01: FifoEmpty, 10: FifoFull
+        const uint8_t flags[4] = { SX1276_IRQ2_FIFO_LEVEL, SX1276_IRQ2_FIFO_EMPTY, SX1276_IRQ2_FIFO_FULL, 0x00 };
+        return (fskIrq2() & flags[mapping]) ? 1 : 0;
+    }
+
+    return 0;
+}
+
+/**
+ * Register value without side effects
+ */
+uint8_t SX1276Emulator::peek(uint8_t addr) const {
+    addr &= 0x7F;
+    if (addr == SX1276_REG_OP_MODE) {
+        return _opMode;
+    }
+    if (loraBank(addr)) {
+        return (addr == SX1276_REG_IRQ_FLAGS) ? _loraIrq : _regLoRa[addr];
+    }
+    if (addr == SX1276_REG_IRQ_FLAGS_1) {
+        return fskIrq1();
+    }
+    if (addr == SX1276_REG_IRQ_FLAGS_2) {
+        return fskIrq2();
+    }
+    if (addr == SX1276_REG_IMAGE_CAL) {
+        // ImageCalRunning (bit 5)
+        return (_regFsk[addr] & ~0x20) | (_now < _imageCalDoneAt ? 0x20 : 0x00);
+    }
+    return _regFsk[addr];
+}
+
+/**
+ * Register 0x0D-0x3F accesses the LoRa page
+ */
+bool SX1276Emulator::loraBank(uint8_t addr) const {
+    // AccessSharedReg (bit 6) maps the FSK page into LoRa mode
+    return isLoRa() && !(_opMode & 0x40) && addr >= 0x0D && addr <= 0x3F;
+}
+
+/**
+ * SPI register read
+ */
+uint8_t SX1276Emulator::readReg(uint8_t addr) {
+    if (addr == SX1276_REG_FIFO) {
+        return readFifo();
+    }
+    return peek(addr);
+}
+
+/**
+ * SPI register write
+ */
+void SX1276Emulator::writeReg(uint8_t addr, uint8_t value) {
+    _writeCount[addr]++;
+
+    if (addr == SX1276_REG_FIFO) {
+        writeFifo(value);
+        return;
+    }
+    if (addr == SX1276_REG_OP_MODE) {
+        writeOpMode(value);
+        return;
+    }
+    if (addr == SX1276_REG_VERSION) {
+        return;  // Read-only
+    }
+
+    if (loraBank(addr)) {
+        if (addr == SX1276_REG_IRQ_FLAGS) {
+            _loraIrq &= ~value;  // Write 1 to clear
+        } else if (addr == SX1276_REG_FIFO_RX_CURRENT_ADDR || (addr >= SX1276_REG_RX_NB_BYTES && addr <= 0x1C)) {
+            // Read-only status registers
+        } else {
+            _regLoRa[addr] = value;
+        }
+        return;
+    }
+
+    if (addr == SX1276_REG_IRQ_FLAGS_1) {
+        // Rssi, PreambleDetect and SyncAddressMatch are cleared by writing 1
+        _irq1 &= ~(value & (SX1276_IRQ1_RSSI | SX1276_IRQ1_PREAMBLE_DETECT | SX1276_IRQ1_SYNC_ADDRESS_MATCH));
+    } else if (addr == SX1276_REG_IRQ_FLAGS_2) {
+        // FifoOverrun (also clears the FIFO) and LowBat are cleared by writing 1
+        if (value & SX1276_IRQ2_FIFO_OVERRUN) {
+            _fskFifo.clear();
+        }
+        _irq2 &= ~(value & (SX1276_IRQ2_FIFO_OVERRUN | SX1276_IRQ2_LOW_BAT));
+    } else if (addr == SX1276_REG_IMAGE_CAL) {
+        // ImageCalStart (bit 6) triggers the calibration in FSK/OOK standby
+        if ((value & 0x40) && !isLoRa() && mode() == SX1276_MODE_STDBY && _now >= _imageCalDoneAt) {
+            _imageCalDoneAt = _now + _timing.imageCalNs;
+            _stats.imageCals++;
+        }
+        _regFsk[addr] = value & ~0x60;
+    } else if (addr == SX1276_REG_TEMP) {
+        // Read-only
+    } else {
+        _regFsk[addr] = value;
+        if (addr == SX1276_REG_FRF_LSB && usesPll(mode())) {
+            // The synthesizer retunes when FRF_LSB is written
+            _pllLockAt = _now + _timing.fsNs;
+        }
+    }
+}
+
+/**
+ * FIFO read (one byte)
+ */
+uint8_t SX1276Emulator::readFifo() {
+    // The FIFO is not accessible in sleep mode
+    if (mode() == SX1276_MODE_SLEEP) {
+        return 0x00;
+    }
+    _stats.fifoBytesRead++;
+
+    if (isLoRa()) {
+        return _loraFifo[_regLoRa[SX1276_REG_FIFO_ADDR_PTR]++];
+    }
+
+    if (_fskFifo.empty()) {
+        return 0x00;
+    }
+    uint8_t value = _fskFifo.front();
+    _fskFifo.pop_front();
+    if (_fskFifo.empty()) {
+        // PayloadReady and CrcOk are cleared when the FIFO has been read out
+        _irq2 &= ~(SX1276_IRQ2_PAYLOAD_READY | SX1276_IRQ2_CRC_OK);
+    }
+    return value;
+}
+
+/**
+ * FIFO write (one byte)
+ */
+void SX1276Emulator::writeFifo(uint8_t value) {
+    if (mode() == SX1276_MODE_SLEEP) {
+        return;
+    }
+    _stats.fifoBytesWritten++;
+
+    if (isLoRa()) {
+        _loraFifo[_regLoRa[SX1276_REG_FIFO_ADDR_PTR]++] = value;
+    } else {
+        fskPush(value);
+    }
+}
+
+/**
+ * Append to the FSK FIFO (sets FifoOverrun when full)
+ */
+void SX1276Emulator::fskPush(uint8_t value) {
+    if (_fskFifo.size() >= SX1276_EMU_FSK_FIFO_SIZE) {
+        _irq2 |= SX1276_IRQ2_FIFO_OVERRUN;
+        return;
+    }
+    _fskFifo.push_back(value);
+}
+
+/**
+ * FSK IRQ_FLAGS_1 (status bits computed from the current state)
+ */
+uint8_t SX1276Emulator::fskIrq1() const {
+    uint8_t flags = _irq1;
+    uint8_t m = mode();
+    if (_now >= _modeReadyAt) {
+        flags |= SX1276_IRQ1_MODE_READY;
+        if (m == SX1276_MODE_TX) {
+            flags |= SX1276_IRQ1_TX_READY;
+        }
+        if (isRxMode(m)) {
+            flags |= SX1276_IRQ1_RX_READY;
+        }
+    }
+    if (usesPll(m) && _now >= _pllLockAt) {
+        flags |= SX1276_IRQ1_PLL_LOCK;
+    }
+    return flags;
+}
+
+/**
+ * FSK IRQ_FLAGS_2 (FIFO status bits computed from the FIFO fill level)
+ */
+uint8_t SX1276Emulator::fskIrq2() const {
+    uint8_t flags = _irq2;
+    size_t level = _fskFifo.size();
+    if (level >= SX1276_EMU_FSK_FIFO_SIZE) {
+        flags |= SX1276_IRQ2_FIFO_FULL;
+    }
+    if (level == 0) {
+        flags |= SX1276_IRQ2_FIFO_EMPTY;
+    }
+    if (level > (size_t)(_regFsk[SX1276_REG_FIFO_THRESH] & 0x3F)) {
+        flags |= SX1276_IRQ2_FIFO_LEVEL;
+    }
+    return flags;
+}
+
+/**
+ * OP_MODE write
+ */
+void SX1276Emulator::writeOpMode(uint8_t value) {
+    uint8_t previous = mode();
+
+    // LongRangeMode can only be changed in sleep mode
+    if (previous != SX1276_MODE_SLEEP) {
+        value = (value & ~0x80) | (_opMode & 0x80);
+    }
+    _opMode = value;
+
+    if ((value & 0x07) != previous) {
+        _stats.modeChanges++;
+        enterMode(previous, value & 0x07);
+    }
+}
+
+/**
+ * Change the mode without an SPI access (automatic transitions)
+ */
+void SX1276Emulator::setModeBits(uint8_t newMode) {
+    uint8_t previous = mode();
+    _opMode = (_opMode & ~0x07) | newMode;
+    enterMode(previous, newMode);
+}
+
+/**
+ * Start a mode transition
+ */
+void SX1276Emulator::enterMode(uint8_t previous, uint8_t newMode) {
+    // Leaving TX/RX aborts a packet in progress
+    if (previous == SX1276_MODE_TX) {
+        _txState = TX_IDLE;
+        _irq2 &= ~SX1276_IRQ2_PACKET_SENT;
+    }
+    if (isRxMode(previous) && !isRxMode(newMode)) {
+        if (_rxActive) {
+            _dropped++;
+        }
+        _rxActive = false;
+    }
+
+    // The FIFO is cleared in sleep mode
+    if (newMode == SX1276_MODE_SLEEP) {
+        memset(_loraFifo, 0, sizeof(_loraFifo));
+        _fskFifo.clear();
+        _irq2 &= ~(SX1276_IRQ2_PAYLOAD_READY | SX1276_IRQ2_CRC_OK | SX1276_IRQ2_FIFO_OVERRUN);
+    }
+
+    // Transition time
+    uint64_t t = 0;
+    if (previous == SX1276_MODE_SLEEP && newMode != SX1276_MODE_SLEEP) {
+        t += _timing.oscNs;
+    }
+    if (usesPll(newMode)) {
+        // Temperature measurement (FSK/OOK, TempMonitorOff = 0)
+        if (!isLoRa() && !(_regFsk[SX1276_REG_IMAGE_CAL] & 0x01)) {
+            _regFsk[SX1276_REG_TEMP] = (uint8_t)(-_temperature);
+        }
+        if (!samePllSide(previous, newMode)) {
+            t += _timing.fsNs;
+            _pllLockAt = _now + t;
+        }
+        if (isRxMode(newMode) && !isLoRa()) {
+            t += rxWakeupNs();
+        } else if (newMode == SX1276_MODE_TX || isRxMode(newMode) || newMode == SX1276_MODE_CAD) {
+            t += _timing.trNs;
+        }
+    } else {
+        _pllLockAt = UINT64_MAX;
+    }
+    _modeReadyAt = _now + t;
+
+    if (newMode == SX1276_MODE_TX) {
+        _txState = TX_WAIT;
+    }
+    if (isRxMode(newMode) && !isRxMode(previous) && isLoRa()) {
+        // Reception starts at the RX base address
+        _regLoRa[0x25] = _regLoRa[SX1276_REG_FIFO_RX_BASE_ADDR];
+    }
+}
+
+/**
+ * Duration of one FSK byte on air
+ */
+uint64_t SX1276Emulator::byteTimeNs() const {
+    // Bitrate = FXOSC / BitRate(15:0) -> 8 bits take 8 * BitRate / 32 MHz = BitRate * 250 ns
+    uint32_t reg = ((uint32_t)_regFsk[SX1276_REG_BITRATE_MSB] << 8) | _regFsk[SX1276_REG_BITRATE_LSB];
+    return (uint64_t)(reg ? reg : 1) * 250;
+}
+
+/**
+ * FSK/OOK receiver wake-up time (inversely proportional to RxBw)
+ */
+uint64_t SX1276Emulator::rxWakeupNs() const {
+    // RxBw = FXOSC / (RxBwMant * 2^(RxBwExp + 2)) -> 1 / RxBw = RxBwMant * 2^(RxBwExp + 2) * 31.25 ns
+    uint8_t rxBw = _regFsk[SX1276_REG_RX_BW];
+    uint64_t mant = 16 + 4 * ((rxBw >> 3) & 0x03);
+    uint64_t period = (mant << ((rxBw & 0x07) + 2)) * 125 / 4;
+    return _timing.rxWakeupPeriods * period;
+}
+
+/**
+ * Duration of one LoRa symbol
+ */
+uint64_t SX1276Emulator::loraSymbolNs() const {
+    static const uint32_t bwHz[10] = { 7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000, 500000 };
+    uint8_t bwIndex = _regLoRa[SX1276_REG_MODEM_CONFIG_1] >> 4;
+    uint8_t sf = _regLoRa[SX1276_REG_MODEM_CONFIG_2] >> 4;
+    if (bwIndex > 9) {
+        bwIndex = 9;
+    }
+    return ((uint64_t)1000000000ULL << sf) / bwHz[bwIndex];
+}
+
+/**
+ * LoRa time on air (datasheet formula)
+ */
+uint64_t SX1276Emulator::loraAirtimeNs(size_t len) const {
+    uint8_t mc1 = _regLoRa[SX1276_REG_MODEM_CONFIG_1];
+    uint8_t mc2 = _regLoRa[SX1276_REG_MODEM_CONFIG_2];
+    int sf = mc2 >> 4;
+    int cr = (mc1 >> 1) & 0x07;
+    int ih = mc1 & 0x01;
+    int crc = (mc2 >> 2) & 0x01;
+    int de = (_regLoRa[SX1276_REG_MODEM_CONFIG_3] & 0x08) ? 1 : 0;
+    int preamble = ((int)_regLoRa[SX1276_REG_PREAMBLE_MSB] << 8) | _regLoRa[SX1276_REG_PREAMBLE_LSB];
+
+    double num = 8.0 * len - 4.0 * sf + 28 + 16 * crc - 20 * ih;
+    double payloadSymbols = 8 + fmax(ceil(num / (4.0 * (sf - 2 * de))) * (cr + 4), 0.0);
+    double symbols = preamble + 4.25 + payloadSymbols;
+    return (uint64_t)(symbols * loraSymbolNs());
+}
+
+/**
+ * Advance the state machine to the current virtual time
+ */
+void SX1276Emulator::process() {
+    if (_inReset || _now < _readyAt) {
+        return;
+    }
+    processHopping();
+    processTx();
+    processRx();
+}
+
+/**
+ * Transmission
+ */
+void SX1276Emulator::processTx() {
+    if (mode() != SX1276_MODE_TX || _txState == TX_IDLE || _txState == TX_DONE) {
+        return;
+    }
+
+    if (isLoRa()) {
+        if (_txState == TX_WAIT && _now >= _modeReadyAt) {
+            // Payload is taken from the FIFO at the TX base address
+            uint8_t len = _regLoRa[SX1276_REG_PAYLOAD_LENGTH];
+            uint8_t addr = _regLoRa[SX1276_REG_FIFO_TX_BASE_ADDR];
+            _txPacket = Packet();
+            for (uint8_t i = 0; i < len; i++) {
+                _txPacket.data.push_back(_loraFifo[(uint8_t)(addr + i)]);
+            }
+            _txPacket.startNs = _modeReadyAt;
+            _txEndNs = _modeReadyAt + loraAirtimeNs(len);
+            _txState = TX_ACTIVE;
+            startHopping(_modeReadyAt);
+        }
+        if (_txState == TX_ACTIVE && _now >= _txEndNs) {
+            _txPacket.endNs = _txEndNs;
+            _sent.push_back(_txPacket);
+            _loraIrq |= SX1276_IRQ_TX_DONE;
+            _txState = TX_DONE;
+
+            // Automatic return to standby
+            setModeBits(SX1276_MODE_STDBY);
+        }
+        return;
+    }
+
+    // FSK/OOK packet mode
+    uint64_t byteTime = byteTimeNs();
+    if (_txState == TX_WAIT) {
+        if (_now < _modeReadyAt) {
+            return;
+        }
+        // TxStartCondition: FIFO not empty (bit 7 set) or FifoLevel
+        bool start = (_regFsk[SX1276_REG_FIFO_THRESH] & 0x80) ? !_fskFifo.empty()
+                                                               : (fskIrq2() & SX1276_IRQ2_FIFO_LEVEL) != 0;
+        if (!start) {
+            return;
+        }
+        uint32_t preamble = ((uint32_t)_regFsk[SX1276_REG_PREAMBLE_MSB_FSK] << 8) | _regFsk[SX1276_REG_PREAMBLE_LSB_FSK];
+        uint8_t syncConfig = _regFsk[SX1276_REG_SYNC_CONFIG];
+        uint32_t syncLen = (syncConfig & 0x10) ? (syncConfig & 0x07) + 1 : 0;
+        _txPacket = Packet();
+        _txPacket.startNs = _now;
+        _txStartNs = _now + (preamble + syncLen) * byteTime;
+        _txTotal = 0;
+        _txSent = 0;
+        _txState = TX_ACTIVE;
+    }
+
+    bool variable = (_regFsk[SX1276_REG_PACKET_CONFIG_1] & 0x80) == 0;
+    while ((_txTotal == 0 || _txSent < _txTotal) && _now >= _txStartNs + _txSent * byteTime) {
+        // Next byte leaves the FIFO when it starts on air
+        uint8_t value = 0x00;
+        if (_fskFifo.empty()) {
+            _stats.txUnderruns++;
+        } else {
+            value = _fskFifo.front();
+            _fskFifo.pop_front();
+        }
+        if (_txSent == 0) {
+            if (variable) {
+                _txTotal = 1 + value;
+            } else {
+                _txTotal = (((size_t)_regFsk[SX1276_REG_PACKET_CONFIG_2] & 0x07) << 8) | _regFsk[SX1276_REG_PAYLOAD_LENGTH_FSK];
+                _txPacket.data.push_back(value);
+            }
+        } else {
+            _txPacket.data.push_back(value);
+        }
+        _txSent++;
+        if (_txTotal == 0) {
+            break;  // Zero length fixed packet
+        }
+    }
+
+    if (_txSent == _txTotal) {
+        uint32_t crcBytes = (_regFsk[SX1276_REG_PACKET_CONFIG_1] & 0x10) ? 2 : 0;
+        _txEndNs = _txStartNs + (_txTotal + crcBytes) * byteTime;
+        if (_now >= _txEndNs) {
+            _txPacket.endNs = _txEndNs;
+            _sent.push_back(_txPacket);
+            _irq2 |= SX1276_IRQ2_PACKET_SENT;
+            _txState = TX_DONE;
+        }
+    }
+}
+
+/**
+ * Reception
+ */
+void SX1276Emulator::processRx() {
+    // Packets which start now are received if the chip is listening
+    while (!_air.empty() && _air.front().startNs <= _now) {
+        Packet packet = _air.front();
+        _air.pop_front();
+        if (isRxMode(mode()) && _modeReadyAt <= packet.startNs && !_rxActive) {
+            startRx(packet);
+        } else {
+            _dropped++;
+        }
+    }
+
+    if (_rxActive) {
+        finishRx();
+    }
+}
+
+/**
+ * Start receiving a packet
+ */
+void SX1276Emulator::startRx(const Packet& packet) {
+    _rxPacket = packet;
+    _rxDelivered = 0;
+    _rxActive = true;
+
+    if (isLoRa()) {
+        _rxPacket.endNs = packet.startNs + loraAirtimeNs(packet.data.size());
+        startHopping(packet.startNs);
+        return;
+    }
+
+    // FSK: payload bytes follow the preamble and sync word
+    uint32_t preamble = ((uint32_t)_regFsk[SX1276_REG_PREAMBLE_MSB_FSK] << 8) | _regFsk[SX1276_REG_PREAMBLE_LSB_FSK];
+    uint8_t syncConfig = _regFsk[SX1276_REG_SYNC_CONFIG];
+    uint32_t syncLen = (syncConfig & 0x10) ? (syncConfig & 0x07) + 1 : 0;
+    _rxDataStartNs = packet.startNs + (preamble + syncLen) * byteTimeNs();
+}
+
+/**
+ * LoRa: packet starts on channel 0, first hop after HopPeriod symbols
+ */
+void SX1276Emulator::startHopping(uint64_t startNs) {
+    uint8_t period = _regLoRa[SX1276_REG_HOP_PERIOD];
+    _regLoRa[SX1276_REG_HOP_CHANNEL] &= ~0x3F;
+    _hopNextNs = (period != 0) ? startNs + period * loraSymbolNs() : UINT64_MAX;
+}
+
+/**
+ * LoRa: FhssChangeChannel events during a packet
+ */
+void SX1276Emulator::processHopping() {
+    while (_now >= _hopNextNs) {
+        uint64_t endNs = 0;
+        if (_txState == TX_ACTIVE) {
+            endNs = _txEndNs;
+        } else if (_rxActive) {
+            endNs = _rxPacket.endNs;
+        }
+        if (_hopNextNs >= endNs) {
+            _hopNextNs = UINT64_MAX;
+            break;
+        }
+
+        if (_loraIrq & SX1276_IRQ_FHSS_CHANGE_CHANNEL) {
+            _stats.hopsMissed++;
+        }
+        uint8_t channel = _regLoRa[SX1276_REG_HOP_CHANNEL];
+        _regLoRa[SX1276_REG_HOP_CHANNEL] = (channel & ~0x3F) | ((channel + 1) & 0x3F);
+        _loraIrq |= SX1276_IRQ_FHSS_CHANGE_CHANNEL;
+        _stats.hops++;
+        _hopNextNs += _regLoRa[SX1276_REG_HOP_PERIOD] * loraSymbolNs();
+    }
+}
+
+/**
+ * Deliver received data up to the current virtual time
+ */
+void SX1276Emulator::finishRx() {
+    if (isLoRa()) {
+        if (_now < _rxPacket.endNs) {
+            return;
+        }
+        // Packet is stored at the current RX byte address
+        uint8_t len = (uint8_t)_rxPacket.data.size();
+        uint8_t addr = _regLoRa[0x25];
+        for (uint8_t i = 0; i < len; i++) {
+            _loraFifo[(uint8_t)(addr + i)] = _rxPacket.data[i];
+        }
+        _regLoRa[SX1276_REG_FIFO_RX_CURRENT_ADDR] = addr;
+        _regLoRa[SX1276_REG_RX_NB_BYTES] = len;
+        _regLoRa[0x25] = addr + len;
+        _regLoRa[SX1276_REG_PKT_SNR_VALUE] = (uint8_t)(_rxPacket.snr * 4);
+        _regLoRa[SX1276_REG_PKT_RSSI_VALUE] = (uint8_t)(_rxPacket.rssi + 157);
+        _loraIrq |= SX1276_IRQ_RX_DONE | SX1276_IRQ_VALID_HEADER;
+        if (!_rxPacket.crcOk && (_regLoRa[SX1276_REG_MODEM_CONFIG_2] & 0x04)) {
+            _loraIrq |= SX1276_IRQ_PAYLOAD_CRC_ERROR;
+        }
+        _rxActive = false;
+        if (mode() == SX1276_MODE_RX_SINGLE) {
+            setModeBits(SX1276_MODE_STDBY);
+        }
+        return;
+    }
+
+    // FSK/OOK packet mode: bytes enter the FIFO at the bitrate
+    if (_now < _rxDataStartNs) {
+        return;
+    }
+    if (_rxDelivered == 0) {
+        _irq1 |= SX1276_IRQ1_PREAMBLE_DETECT | SX1276_IRQ1_SYNC_ADDRESS_MATCH | SX1276_IRQ1_RSSI;
+        _regFsk[SX1276_REG_RSSI_VALUE_FSK] = (uint8_t)(-2 * _rxPacket.rssi);
+    }
+
+    // On-air byte sequence: length byte (variable length) + payload
+    bool variable = (_regFsk[SX1276_REG_PACKET_CONFIG_1] & 0x80) == 0;
+    size_t payloadLen = _rxPacket.data.size();
+    if (!variable) {
+        payloadLen = (((size_t)_regFsk[SX1276_REG_PACKET_CONFIG_2] & 0x07) << 8) | _regFsk[SX1276_REG_PAYLOAD_LENGTH_FSK];
+    }
+    size_t total = payloadLen + (variable ? 1 : 0);
+
+    uint64_t byteTime = byteTimeNs();
+    while (_rxDelivered < total && _now >= _rxDataStartNs + (_rxDelivered + 1) * byteTime) {
+        size_t index = variable ? _rxDelivered - 1 : _rxDelivered;
+        uint8_t value;
+        if (variable && _rxDelivered == 0) {
+            value = (uint8_t)payloadLen;
+        } else {
+            value = (index < _rxPacket.data.size()) ? _rxPacket.data[index] : 0x00;
+        }
+        fskPush(value);
+        _rxDelivered++;
+    }
+
+    bool crcOn = (_regFsk[SX1276_REG_PACKET_CONFIG_1] & 0x10) != 0;
+    uint64_t endNs = _rxDataStartNs + (total + (crcOn ? 2 : 0)) * byteTime;
+    if (_rxDelivered < total || _now < endNs) {
+        return;
+    }
+
+    _rxActive = false;
+    if (_irq2 & SX1276_IRQ2_FIFO_OVERRUN) {
+        _dropped++;
+        return;
+    }
+    if (crcOn && !_rxPacket.crcOk && !(_regFsk[SX1276_REG_PACKET_CONFIG_1] & 0x08)) {
+        // CrcAutoClearOff = 0: FIFO is cleared, no PayloadReady
+        _fskFifo.clear();
+        _dropped++;
+        return;
+    }
+    _irq2 |= SX1276_IRQ2_PAYLOAD_READY;
+    if (crcOn && _rxPacket.crcOk) {
+        _irq2 |= SX1276_IRQ2_CRC_OK;
+    }
+}
@@ -0,0 +1,262 @@
+/**
+ * SX1276Emulator.h
+ *
+ * SX1276_Radio_Lite - Lightweight SX1276 radio library for Arduino
+ * Register-level behavioral model of the SX1276 for host builds
+ *
+ * Connects to the host HAL (SX1276HalHost.h) as SX1276HostDevice and models:
+ * - register file with LoRa/FSK banked registers (0x0D-0x3F) and reset defaults
+ * - 256-byte LoRa FIFO (FifoAddrPtr based) and 64-byte FSK FIFO
+ * - OP_MODE transitions with datasheet transition times (ModeReady, PllLock),
+ *   PLL relock when FRF is changed in FS/TX/RX
+ * - LoRa IRQ flags (REG_IRQ_FLAGS) and FSK IRQ_FLAGS_1/IRQ_FLAGS_2
+ * - LoRa frequency hopping (HOP_PERIOD, FhssPresentChannel, FhssChangeChannel)
+ * - temperature sensor (REG_TEMP) and image calibration (ImageCalStart/ImageCalRunning)
+ * - DIO0/DIO1 lines according to DIO_MAPPING_1
+ * - packet transmission and reception with time-on-air on the virtual clock
+ * - SPI transaction/byte counters
+ *
+ * This is a model for benchmarks and regression checks, not a radio simulator:
+ * there is no channel model, packets are injected with injectPacket() and
+ * transmitted packets are collected in sentPackets().
+ *
+ * Copyright (c) 2024 Matthias Prinke
+ * Licensed under MIT License
+ */
+
+#ifndef SX1276_EMULATOR_H
+#define SX1276_EMULATOR_H
+
+#include "SX1276.h"
+
+#include <deque>
+#include <vector>
+
+/**
+ * Emulated SX1276 chip
+ */
+class SX1276Emulator : public SX1276HostDevice {
+public:
+    /**
+     * SPI bus counters
+     */
+    struct Stats {
+        uint32_t transactions;      // Chip select assertions
+        uint32_t bytes;             // Bytes on the bus (including address bytes)
+        uint32_t registerReads;     // Read transactions
+        uint32_t registerWrites;    // Write transactions
+        uint32_t fifoBytesRead;     // Data bytes read from the FIFO
+        uint32_t fifoBytesWritten;  // Data bytes written to the FIFO
+        uint32_t resets;            // Reset pulses
+        uint32_t modeChanges;       // OP_MODE writes which changed the mode
+        uint32_t txUnderruns;       // FSK: FIFO ran empty during transmission
+        uint32_t hops;              // LoRa FHSS: FhssChangeChannel events
+        uint32_t hopsMissed;        // LoRa FHSS: previous event not yet cleared at the next hop
+        uint32_t imageCals;         // Image calibrations started
+    };
+
+    /**
+     * Over-the-air packet (injected for reception or collected on transmission)
+     */
+    struct Packet {
+        Packet() : startNs(0), endNs(0), crcOk(true), rssi(-60), snr(10) {}
+        std::vector<uint8_t> data;
+        uint64_t startNs;           // Start of the preamble (virtual time)
+        uint64_t endNs;             // End of the packet (filled in by the emulator)
+        bool crcOk;                 // Received with valid CRC
+        int16_t rssi;               // RSSI in dBm
+        int8_t snr;                 // SNR in dB (LoRa)
+    };
+
+    /**
+     * Mode transition times in nanoseconds (datasheet typical values)
+     */
+    struct Timing {
+        Timing() : resetNs(5000000), oscNs(250000), fsNs(60000), trNs(60000), imageCalNs(10000000),
+                   rxWakeupPeriods(30) {}
+        uint64_t resetNs;           // Chip ready after releasing reset
+        uint64_t oscNs;             // SLEEP -> STDBY (crystal oscillator startup)
+        uint64_t fsNs;              // STDBY -> FS (PLL lock)
+        uint64_t trNs;              // FS -> TX/RX (PA ramp / receiver startup), not FSK/OOK RX
+        uint64_t imageCalNs;        // Image and RSSI calibration
+        uint32_t rxWakeupPeriods;   // FSK/OOK FS -> RX in periods of 1/RxBw (TS_RE_AGC: ~3 ms at 10.4 kHz)
+    };
+
+    /**
+     * Constructor
+     * @param cs Chip select pin
+     * @param rst Reset pin
+     * @param dio0 DIO0 pin
+     * @param dio1 DIO1 pin (-1 if not connected)
+     */
+    SX1276Emulator(int cs, int rst, int dio0, int dio1 = -1);
+
+    // SX1276HostDevice
+    uint8_t transfer(uint8_t data) override;
+    void writePin(int pin, int value) override;
+    int readPin(int pin) override;
+    void tick(uint64_t nowNs) override;
+
+    /**
+     * Power-on reset (registers to defaults, counters kept)
+     */
+    void powerOn();
+
+    /**
+     * Schedule a packet on air
+     * It is received if the chip is in RX when the packet starts.
+     * @param data Payload
+     * @param len Payload length
+     * @param startNs Virtual time at which the preamble starts
+     * @param crcOk Received with valid CRC
+     * @param rssi RSSI in dBm
+     */
+    void injectPacket(const uint8_t* data, size_t len, uint64_t startNs, bool crcOk = true, int16_t rssi = -60);
+
+    /**
+     * Packets transmitted by the driver
+     */
+    const std::vector<Packet>& sentPackets() const { return _sent; }
+
+    /**
+     * Number of injected packets which were missed (chip not in RX or FIFO overrun)
+     */
+    uint32_t droppedPackets() const { return _dropped; }
+
+    /**
+     * Counters
+     */
+    const Stats& stats() const { return _stats; }
+    void resetStats();
+
+    /**
+     * Number of write accesses to a register since the last resetStats()
+     * (LoRa and FSK bank are counted together)
+     */
+    uint32_t writeCount(uint8_t addr) const { return _writeCount[addr & 0x7F]; }
+
+    /**
+     * Transition times
+     */
+    Timing& timing() { return _timing; }
+
+    /**
+     * Register value as seen by the SPI interface in the current bank
+     */
+    uint8_t peek(uint8_t addr) const;
+
+    /**
+     * Current operating mode (OP_MODE bits 2-0)
+     */
+    uint8_t mode() const { return _opMode & 0x07; }
+
+    /**
+     * LoRa mode selected (OP_MODE bit 7)
+     */
+    bool isLoRa() const { return (_opMode & 0x80) != 0; }
+
+    /**
+     * Die temperature seen by the temperature sensor (degrees C)
+     * REG_TEMP is updated when FS/RX is entered in FSK/OOK mode with TempMonitorOff = 0.
+     */
+    void setTemperature(int8_t celsius) { _temperature = celsius; }
+
+    /**
+     * Current level of a DIO line (0 or 1)
+     */
+    int dio(uint8_t index) const;
+
+private:
+    // Pins
+    int _csPin;
+    int _rstPin;
+    int _dio0Pin;
+    int _dio1Pin;
+
+    // Register file: common/FSK page and LoRa page (0x0D-0x3F are banked)
+    uint8_t _regFsk[128];
+    uint8_t _regLoRa[128];
+    uint8_t _opMode;
+
+    // Dynamic status
+    uint8_t _loraIrq;           // LoRa REG_IRQ_FLAGS
+    uint8_t _irq1;              // FSK IRQ_FLAGS_1 (latched bits only)
+    uint8_t _irq2;              // FSK IRQ_FLAGS_2 (latched bits only)
+
+    // FIFOs
+    uint8_t _loraFifo[256];
+    std::deque<uint8_t> _fskFifo;
+
+    // SPI transaction state
+    bool _selected;
+    bool _inReset;
+    int _byteIndex;
+    uint8_t _addr;
+    bool _write;
+
+    // Time
+    uint64_t _now;
+    uint64_t _readyAt;          // Chip accessible after reset
+    uint64_t _modeReadyAt;      // Mode transition complete
+    uint64_t _pllLockAt;        // PLL locked (FS/TX/RX)
+
+    // Transmission
+    enum TxState { TX_IDLE, TX_WAIT, TX_ACTIVE, TX_DONE };
+    TxState _txState;
+    uint64_t _txStartNs;        // First payload byte starts
+    uint64_t _txEndNs;          // Packet sent
+    size_t _txTotal;            // FSK: bytes to send (0 = not yet known)
+    size_t _txSent;             // FSK: bytes taken from the FIFO
+    Packet _txPacket;
+
+    // Reception
+    std::deque<Packet> _air;    // Packets scheduled on air
+    bool _rxActive;
+    Packet _rxPacket;
+    size_t _rxDelivered;        // FSK: bytes pushed into the FIFO
+    uint64_t _rxDataStartNs;    // FSK: first byte after preamble and sync word
+
+    // LoRa frequency hopping
+    uint64_t _hopNextNs;        // Next FhssChangeChannel event, UINT64_MAX if not hopping
+
+    // Temperature sensor and image calibration
+    int8_t _temperature;
+    uint64_t _imageCalDoneAt;   // ImageCalRunning until then
+
+    std::vector<Packet> _sent;
+    uint32_t _dropped;
+    Stats _stats;
+    uint32_t _writeCount[128];
+    Timing _timing;
+
+    // Register access
+    bool loraBank(uint8_t addr) const;
+    uint8_t readReg(uint8_t addr);
+    void writeReg(uint8_t addr, uint8_t value);
+    uint8_t readFifo();
+    void writeFifo(uint8_t value);
+    void writeOpMode(uint8_t value);
+    void loadDefaults();
+
+    // FSK FIFO helpers
+    uint8_t fskIrq1() const;
+    uint8_t fskIrq2() const;
+    void fskPush(uint8_t value);
+
+    // State machine
+    void enterMode(uint8_t previous, uint8_t mode);
+    void setModeBits(uint8_t mode);
+    void processTx();
+    void processRx();
+    void startRx(const Packet& packet);
+    void finishRx();
+    void startHopping(uint64_t startNs);
+    void processHopping();
+    void process();
+    uint64_t byteTimeNs() const;
+    uint64_t rxWakeupNs() const;
+    uint64_t loraAirtimeNs(size_t len) const;
+    uint64_t loraSymbolNs() const;
+};
+
+#endif // SX1276_EMULATOR_H
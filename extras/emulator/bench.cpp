@@ -0,0 +1,295 @@
+/**
+ * bench.cpp
+ *
+ * SX1276_Radio_Lite - Lightweight SX1276 radio library for Arduino
+ * Host benchmark: SPI traffic and (virtual) latency of the main driver calls
+ *
+ * Build and run from the library root:
+ *   g++ -std=gnu++11 -O2 -I. -Iextras/emulator extras/emulator/bench.cpp \
+ *       extras/emulator/SX1276Emulator.cpp SX1276.cpp -o sx1276_bench
+ *   ./sx1276_bench
+ *
+ * Copyright (c) 2024 Matthias Prinke
+ * Licensed under MIT License
+ */
+
+#include "SX1276.h"
+#include "SX1276Emulator.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Pin numbers seen by the emulator
+#define PIN_CS      10
+#define PIN_RST     9
+#define PIN_DIO0    2
+#define PIN_DIO1    3
+
+static SX1276Emulator chip(PIN_CS, PIN_RST, PIN_DIO0, PIN_DIO1);
+
+// Measurement of one driver call
+struct Sample {
+    uint64_t startNs;
+    SX1276Emulator::Stats before;
+};
+
+static Sample begin() {
+    Sample s;
+    s.startNs = SX1276Hal::nanos();
+    s.before = chip.stats();
+    return s;
+}
+
+static void report(const char* name, const Sample& s, int16_t result) {
+    const SX1276Emulator::Stats& now = chip.stats();
+    printf("%-22s result=%4d  transactions=%4u  bytes=%5u  time=%9.1f us\n",
+           name, result,
+           (unsigned)(now.transactions - s.before.transactions),
+           (unsigned)(now.bytes - s.before.bytes),
+           (SX1276Hal::nanos() - s.startNs) / 1000.0);
+}
+
+#ifdef SX1276_ASYNC_FIFO
+// Failed checks of the background FIFO transfer sequence
+static unsigned failures = 0;
+
+static void check(const char* name, bool ok) {
+    printf("%-22s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok) {
+        failures++;
+    }
+}
+#endif
+
+#ifdef SX1276_RX_QUEUE
+// Inject SX1276_RX_QUEUE_SIZE + 2 packets 100 ms apart and collect them with available()
+static void queueBurst(SX1276& radio, const char* name, const uint8_t* payload, size_t len) {
+    const unsigned count = SX1276_RX_QUEUE_SIZE + 2;
+    uint16_t overflows = radio.getQueueOverflows();
+    uint64_t t = SX1276Hal::nanos() + 5000000ULL;
+    for (unsigned i = 0; i < count; i++) {
+        chip.injectPacket(payload, len, t);
+        t += 100000000ULL;
+    }
+    Sample s = begin();
+    int16_t state = radio.startReceive();
+    while (state == SX1276_ERR_NONE && SX1276Hal::nanos() < t) {
+        radio.available();
+        SX1276Hal::delay(1);
+    }
+    report(name, s, state);
+    printf("%-22s packets=%u queued=%u overflows=%u\n", "", count, (unsigned)radio.available(),
+           (unsigned)(radio.getQueueOverflows() - overflows));
+    radio.standby();
+
+    // Empty the queue for the next run
+    SX1276Packet packet;
+    while (radio.readPacket(packet) > 0) {
+        // Discard
+    }
+}
+#endif
+
+int main() {
+    SX1276Hal::attach(&chip);
+
+    SX1276 radio(PIN_CS, PIN_DIO0, PIN_RST, PIN_DIO1);
+    uint8_t payload[32];
+    uint8_t buf[SX1276_MAX_PACKET_LENGTH];
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (uint8_t)i;
+    }
+
+#ifdef LORA_ENABLED
+    printf("LoRa (SF7, 125 kHz, 32 byte payload)\n");
+    Sample s = begin();
+    int16_t state = radio.begin(868000000L, PIN_CS, PIN_RST, PIN_DIO0);
+    report("begin()", s, state);
+
+    s = begin();
+    state = radio.transmit(payload, sizeof(payload));
+    report("transmit()", s, state);
+
+    // Non-blocking: the DIO0 interrupt sets a flag, polling it needs no SPI access
+    s = begin();
+    state = radio.startTransmit(payload, sizeof(payload));
+    while (state == SX1276_ERR_NONE && !radio.isTransmitDone()) {
+        SX1276Hal::delay(1);
+    }
+    state = (state == SX1276_ERR_NONE) ? radio.finishTransmit() : state;
+    report("startTransmit()+poll", s, state);
+
+#ifdef SX1276_ASYNC_FIFO
+    // Payload loaded by the fake DMA engine, TX entered from isTransmitDone()
+    // (build with -DSX1276_ASYNC_FIFO)
+    s = begin();
+    state = radio.startTransmitAsync(payload, sizeof(payload));
+    uint64_t returnedNs = SX1276Hal::nanos() - s.startNs;
+    while (state == SX1276_ERR_NONE && !radio.isTransmitDone()) {
+        SX1276Hal::yield();
+    }
+    state = (state == SX1276_ERR_NONE) ? radio.finishTransmit() : state;
+    report("startTransmitAsync()", s, state);
+    printf("%-22s returned after %.1f us\n", "", returnedNs / 1000.0);
+
+    // Sequence: load in progress (bus busy, still in standby) -> load done -> TX
+    check("async TX started", radio.startTransmitAsync(payload, sizeof(payload)) == SX1276_ERR_NONE);
+    check("async TX busy", !radio.isFifoTransferDone() && chip.mode() == SX1276_MODE_STDBY);
+    check("async TX second start", radio.startTransmitAsync(payload, sizeof(payload)) == SX1276_ERR_BUSY);
+    while (!radio.isFifoTransferDone()) {
+        SX1276Hal::yield();
+    }
+    check("async TX entered", chip.mode() == SX1276_MODE_TX);
+    while (!radio.isTransmitDone()) {
+        SX1276Hal::yield();
+    }
+    check("async TX done", radio.finishTransmit() == SX1276_ERR_NONE);
+#endif
+
+    // Packet starts 5 ms from now
+    chip.injectPacket(payload, sizeof(payload), SX1276Hal::nanos() + 5000000ULL);
+    s = begin();
+    state = radio.receive(buf, sizeof(buf));
+    report("receive()", s, state);
+
+    chip.injectPacket(payload, sizeof(payload), SX1276Hal::nanos() + 5000000ULL);
+    s = begin();
+    state = radio.startReceive();
+    while (state == SX1276_ERR_NONE && !radio.isPacketAvailable()) {
+        SX1276Hal::delay(1);
+    }
+    state = (state == SX1276_ERR_NONE) ? radio.readData(buf, sizeof(buf)) : state;
+    report("startReceive()+poll", s, state);
+
+#ifdef SX1276_ASYNC_FIFO
+    // Payload drained by the fake DMA engine after RxDone
+    chip.injectPacket(payload, sizeof(payload), SX1276Hal::nanos() + 5000000ULL);
+    state = radio.startReceive();
+    while (state == SX1276_ERR_NONE && !radio.isPacketAvailable()) {
+        SX1276Hal::delay(1);
+    }
+    memset(buf, 0, sizeof(buf));
+    check("async RX started", radio.readDataAsync(buf, sizeof(buf)) == (int16_t)sizeof(payload));
+    check("async RX busy", !radio.isFifoTransferDone());
+    check("async RX second start", radio.readDataAsync(buf, sizeof(buf)) == SX1276_ERR_BUSY);
+    while (!radio.isFifoTransferDone()) {
+        SX1276Hal::yield();
+    }
+    check("async RX data", memcmp(buf, payload, sizeof(payload)) == 0);
+#endif
+
+    // Wake cycle: configuration retained in sleep mode
+    radio.sleep();
+    s = begin();
+    state = radio.resume();
+    report("resume()", s, state);
+#endif
+
+#ifdef FSK_OOK_ENABLED
+    printf("FSK (4.8 kbps, 32 byte payload)\n");
+    s = begin();
+    state = radio.setModulation(SX1276_MODULATION_FSK);
+    report("setModulation(FSK)", s, state);
+
+    s = begin();
+    state = radio.transmit(payload, sizeof(payload));
+    report("transmit()", s, state);
+
+    chip.injectPacket(payload, sizeof(payload), SX1276Hal::nanos() + 5000000ULL);
+    s = begin();
+    state = radio.receive(buf, sizeof(buf));
+    report("receive()", s, state);
+
+    // Receiver wake-up time grows with 1/RxBw (about 12 ms at 2.6 kHz)
+    radio.setRxBandwidth(SX1276_RX_BW_2_6_KHZ);
+    s = begin();
+    state = radio.startReceive();
+    report("startReceive() 2.6 kHz", s, state);
+    radio.standby();
+    radio.setRxBandwidth(SX1276_RX_BW_10_4_KHZ_FSK);
+
+#ifdef SX1276_ASYNC_FIFO
+    // Packet longer than the buffer: the rest is cleared from the FIFO when the transfer is done
+    chip.injectPacket(payload, sizeof(payload), SX1276Hal::nanos() + 5000000ULL);
+    state = radio.startReceive();
+    while (state == SX1276_ERR_NONE && !radio.isPacketAvailable()) {
+        SX1276Hal::delay(1);
+    }
+    memset(buf, 0, sizeof(buf));
+    check("async RX truncated", radio.readDataAsync(buf, 16) == 16);
+    while (!radio.isFifoTransferDone()) {
+        SX1276Hal::yield();
+    }
+    check("async RX data", memcmp(buf, payload, 16) == 0 && buf[16] == 0);
+    check("async RX FIFO empty", (chip.peek(SX1276_REG_IRQ_FLAGS_2) & SX1276_IRQ2_FIFO_EMPTY) != 0);
+#endif
+#endif
+
+#if defined(LORA_ENABLED) && defined(FSK_OOK_ENABLED)
+    // Gateway pattern: alternate between a LoRa and an FSK channel
+    printf("Modem switching\n");
+    s = begin();
+    state = radio.setModulation(SX1276_MODULATION_LORA);
+    report("setModulation(LoRa)", s, state);
+
+    s = begin();
+    state = radio.setModulation(SX1276_MODULATION_FSK);
+    report("setModulation(FSK)", s, state);
+
+    s = begin();
+    state = radio.setModulation(SX1276_MODULATION_LORA);
+    report("setModulation(LoRa)", s, state);
+#endif
+
+    // Channel hopping with the synthesizer locked (FSRX)
+    printf("Frequency hopping\n");
+    static const uint32_t plan[] = { SX1276Reg::frf(868100000UL), SX1276Reg::frf(868300000UL) };
+    radio.setChannelPlan(plan, 2);
+
+    radio.standby();
+    s = begin();
+    state = radio.setFrequency(868100000L);
+    state = (state == SX1276_ERR_NONE) ? radio.prepareReceive() : state;
+    report("setFrequency()+FSRX", s, state);
+
+    s = begin();
+    state = radio.hopTo(1);
+    report("hopTo() in FSRX", s, state);
+
+#ifdef LORA_ENABLED
+    // LoRa FHSS over the same plan (FRF rewritten on each FhssChangeChannel via DIO1)
+    if (radio.setModulation(SX1276_MODULATION_LORA) == SX1276_ERR_NONE &&
+        radio.setFrequencyHopping(10) == SX1276_ERR_NONE) {
+        uint32_t hops = chip.stats().hops;
+        s = begin();
+        state = radio.transmit(payload, sizeof(payload));
+        report("transmit() FHSS", s, state);
+        printf("%-22s hops=%u missed=%u\n", "", (unsigned)(chip.stats().hops - hops), (unsigned)chip.stats().hopsMissed);
+        radio.setFrequencyHopping(0);
+    }
+#endif
+
+#ifdef SX1276_RX_QUEUE
+    // Burst of packets captured while the radio stays in RX (build with -DSX1276_RX_QUEUE):
+    // two more packets than the queue holds, so the last two are counted as overflows
+    printf("Continuous reception\n");
+#ifdef LORA_ENABLED
+    if (radio.setModulation(SX1276_MODULATION_LORA) == SX1276_ERR_NONE) {
+        queueBurst(radio, "LoRa queue burst", payload, sizeof(payload));
+    }
+#endif
+#ifdef FSK_OOK_ENABLED
+    // FSK/OOK: FIFO read out in RX_CONTINUOUS, receiver restarted by AutoRestartRxMode
+    if (radio.setModulation(SX1276_MODULATION_FSK) == SX1276_ERR_NONE) {
+        queueBurst(radio, "FSK queue burst", payload, sizeof(payload));
+    }
+#endif
+#endif
+
+    printf("packets sent=%u dropped=%u\n", (unsigned)chip.sentPackets().size(), (unsigned)chip.droppedPackets());
+#ifdef SX1276_ASYNC_FIFO
+    return (failures == 0) ? 0 : 1;
+#else
+    return 0;
+#endif
+}